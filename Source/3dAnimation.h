@@ -196,6 +196,7 @@ private:
         float        position;
         AnimSet*     anim;
         OutputPtrVec animOutput;
+        UIntVec      keyCursors; // Last found scale, rotation and translation keys for each bone output
         EventVec     events;
     };
     typedef vector< Track > TrackVec;
@@ -299,6 +300,7 @@ public:
         tracks[ track ].anim = anim;
         uint count = anim->GetBoneOutputCount();
         tracks[ track ].animOutput.resize( count );
+        tracks[ track ].keyCursors.assign( count * 3, 0 );
         for( uint i = 0; i < count; i++ )
         {
             hash    link_name_hash = anim->boneOutputs[ i ].nameHash;
@@ -451,17 +453,17 @@ public:
             if( !track.enabled || track.weight <= 0.0f || !track.anim )
                 continue;
 
+            float time = fmod( track.position * track.anim->ticksPerSecond, track.anim->durationTicks );
             for( uint k = 0, l = (uint) track.anim->boneOutputs.size(); k < l; k++ )
             {
                 if( !track.animOutput[ k ] )
                     continue;
 
                 AnimSet::BoneOutput& o = track.anim->boneOutputs[ k ];
-
-                float                time = fmod( track.position * track.anim->ticksPerSecond, track.anim->durationTicks );
-                FindSRTValue< Vector >( time, o.scaleTime, o.scaleValue, track.animOutput[ k ]->scale[ i ] );
-                FindSRTValue< Quaternion >( time, o.rotationTime, o.rotationValue, track.animOutput[ k ]->rotation[ i ] );
-                FindSRTValue< Vector >( time, o.translationTime, o.translationValue, track.animOutput[ k ]->translation[ i ] );
+                uint*                cursors = &track.keyCursors[ k * 3 ];
+                FindSRTValue< Vector >( time, o.scaleTime, o.scaleValue, track.animOutput[ k ]->scale[ i ], cursors[ 0 ] );
+                FindSRTValue< Quaternion >( time, o.rotationTime, o.rotationValue, track.animOutput[ k ]->rotation[ i ], cursors[ 1 ] );
+                FindSRTValue< Vector >( time, o.translationTime, o.translationValue, track.animOutput[ k ]->translation[ i ], cursors[ 2 ] );
                 track.animOutput[ k ]->valid[ i ] = true;
                 track.animOutput[ k ]->factor[ i ] = track.weight;
             }
@@ -479,11 +481,7 @@ public:
                 Interpolate( o.scale[ 0 ], o.scale[ 1 ], factor );
                 Interpolate( o.rotation[ 0 ], o.rotation[ 1 ], factor );
                 Interpolate( o.translation[ 0 ], o.translation[ 1 ], factor );
-                Matrix ms, mr, mt;
-                Matrix::Scaling( o.scale[ 0 ], ms );
-                mr = Matrix( o.rotation[ 0 ].GetMatrix() );
-                Matrix::Translation( o.translation[ 0 ], mt );
-                *o.matrix = mt * mr * ms;
+                ComposeMatrix( o.scale[ 0 ], o.rotation[ 0 ], o.translation[ 0 ], *o.matrix );
             }
             else
             {
@@ -491,11 +489,7 @@ public:
                 {
                     if( o.valid[ k ] )
                     {
-                        Matrix ms, mr, mt;
-                        Matrix::Scaling( o.scale[ k ], ms );
-                        mr = Matrix( o.rotation[ k ].GetMatrix() );
-                        Matrix::Translation( o.translation[ k ], mt );
-                        *o.matrix = mt * mr * ms;
+                        ComposeMatrix( o.scale[ k ], o.rotation[ k ], o.translation[ k ], *o.matrix );
                         break;
                     }
                 }
@@ -505,26 +499,54 @@ public:
 
 private:
     template< class T >
-    void FindSRTValue( float time, FloatVec& times, vector< T >& values, T& result )
+    void FindSRTValue( float time, FloatVec& times, vector< T >& values, T& result, uint& cursor )
     {
-        for( uint n = 0, m = (uint) times.size(); n < m; n++ )
+        uint m = (uint) times.size();
+        if( !m )
+            return;
+
+        // Outside of keys range last key is used
+        if( m == 1 || !( time >= times[ 0 ] && time < times[ m - 1 ] ) )
         {
-            if( n + 1 < m )
-            {
-                if( time >= times[ n ] && time < times[ n + 1 ] )
-                {
-                    result = values[ n ];
-                    T&    value = values[ n + 1 ];
-                    float factor = ( time - times[ n ] ) / ( times[ n + 1 ] - times[ n ] );
-                    Interpolate( result, value, factor );
-                    return;
-                }
-            }
-            else
-            {
-                result = values[ n ];
-            }
+            result = values[ m - 1 ];
+            return;
+        }
+
+        // Time mostly goes forward, so check last found and next keys before search
+        uint n = cursor;
+        if( !( n + 1 < m && time >= times[ n ] && time < times[ n + 1 ] ) )
+        {
+            n++;
+            if( !( n + 1 < m && time >= times[ n ] && time < times[ n + 1 ] ) )
+                n = (uint) ( std::upper_bound( times.begin(), times.end(), time ) - times.begin() ) - 1;
+            cursor = n;
         }
+
+        result = values[ n ];
+        float factor = ( time - times[ n ] ) / ( times[ n + 1 ] - times[ n ] );
+        Interpolate( result, values[ n + 1 ], factor );
+    }
+
+    static void ComposeMatrix( const Vector& s, const Quaternion& r, const Vector& t, Matrix& m )
+    {
+        // Same as translation * rotation * scaling, without full matrices multiplication
+        aiMatrix3x3 mr = r.GetMatrix();
+        m.a1 = mr.a1 * s.x;
+        m.a2 = mr.a2 * s.y;
+        m.a3 = mr.a3 * s.z;
+        m.a4 = t.x;
+        m.b1 = mr.b1 * s.x;
+        m.b2 = mr.b2 * s.y;
+        m.b3 = mr.b3 * s.z;
+        m.b4 = t.y;
+        m.c1 = mr.c1 * s.x;
+        m.c2 = mr.c2 * s.y;
+        m.c3 = mr.c3 * s.z;
+        m.c4 = t.z;
+        m.d1 = 0.0f;
+        m.d2 = 0.0f;
+        m.d3 = 0.0f;
+        m.d4 = 1.0f;
     }
 
     void Interpolate( Quaternion& q1, const Quaternion& q2, float factor )
@@ -1078,7 +1078,7 @@ void Animation3d::ProcessAnimation( float elapsed, int x, int y, float scale )
     }
 
     // Update matrices
-    UpdateBoneMatrices( animEntity->xFile->rootBone, &parentMatrix );
+    UpdateBoneMatrices();
 
     // Update linked matrices
     if( parentBone && linkBones.size() )
@@ -1118,14 +1118,14 @@ void Animation3d::ProcessAnimation( float elapsed, int x, int y, float scale )
     }
 }
 
-void Animation3d::UpdateBoneMatrices( Bone* bone, const Matrix* parent_matrix )
+void Animation3d::UpdateBoneMatrices()
 {
-    // If parent matrix exists multiply our bone matrix by it
-    bone->CombinedTransformationMatrix = ( *parent_matrix ) * bone->TransformationMatrix;
-
-    // Update child
-    for( auto it = bone->Children.begin(), end = bone->Children.end(); it != end; ++it )
-        UpdateBoneMatrices( *it, &bone->CombinedTransformationMatrix );
+    // Bones sorted by depth, so parent matrix always ready before child
+    BoneVec& bones = animEntity->xFile->allBones;
+    UIntVec& parents = animEntity->xFile->allBonesParents;
+    bones[ 0 ]->CombinedTransformationMatrix = parentMatrix * bones[ 0 ]->TransformationMatrix;
+    for( size_t i = 1, j = bones.size(); i < j; i++ )
+        bones[ i ]->CombinedTransformationMatrix = bones[ parents[ i ] ]->CombinedTransformationMatrix * bones[ i ]->TransformationMatrix;
 }
 
 void Animation3d::DrawCombinedMeshes()
@@ -2404,6 +2404,24 @@ void Animation3dXFile::SetupBones()
         if( bone->Mesh )
             allDrawBones.push_back( bone );
     }
+
+    // Parent indices for linear matrices update, root has no parent
+    allBonesParents.resize( allBones.size() );
+    allBonesParents[ 0 ] = 0;
+    for( size_t i = 0; i < allBones.size(); i++ )
+    {
+        for( Bone* child : allBones[ i ]->Children )
+        {
+            for( size_t j = i + 1; j < allBones.size(); j++ )
+            {
+                if( allBones[ j ] == child )
+                {
+                    allBonesParents[ j ] = (uint) i;
+                    break;
+                }
+            }
+        }
+    }
 }
 
 void SetupAnimationOutputExt( AnimController* anim_controller, Bone* bone )
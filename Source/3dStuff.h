@@ -114,7 +114,7 @@ private:
     void  CutCombinedMeshes( Animation3d* base, Animation3d* cur );
     void  CutCombinedMesh( CombinedMesh* combined_mesh, CutData* cut );
     void  ProcessAnimation( float elapsed, int x, int y, float scale );
-    void  UpdateBoneMatrices( Bone* bone, const Matrix* parent_matrix );
+    void  UpdateBoneMatrices();
     void  DrawCombinedMeshes();
     void  DrawCombinedMesh( CombinedMesh* combined_mesh, bool shadow_disabled );
     float GetSpeed();
@@ -207,6 +207,7 @@ private:
     string                     fileName;
     Bone*                      rootBone;
     BoneVec                    allBones;
+    UIntVec                    allBonesParents;
     BoneVec                    allDrawBones;
 
     static Animation3dXFile* GetXFile( const string& xname );
@@ -38,6 +38,39 @@ void BufferManager::SetEncryptKey( uint seed )
     encryptActive = true;
 }
 
+static UCharVec MakeCompressionDictionary()
+{
+    // Headers of frequent game messages, most frequent placed to the end of dictionary
+    static const uint msgs[] =
+    {
+        NETMSG_GAME_INFO, NETMSG_LOADMAP, NETMSG_ADD_PLAYER, NETMSG_ADD_NPC, NETMSG_REMOVE_CRITTER,
+        NETMSG_ALL_ITEMS_SEND, NETMSG_ADD_ITEM, NETMSG_REMOVE_ITEM, NETMSG_ANIMATE_ITEM, NETMSG_CRITTER_MOVE_ITEM,
+        NETMSG_CRITTER_ANIMATE, NETMSG_CRITTER_SET_ANIMS, NETMSG_EFFECT, NETMSG_FLY_EFFECT, NETMSG_PLAY_SOUND,
+        NETMSG_MSG, NETMSG_MSG_LEX, NETMSG_MAP_TEXT, NETMSG_MAP_TEXT_MSG, NETMSG_CRITTER_TEXT, NETMSG_RPC,
+        NETMSG_COMPLEX_PROPERTY, NETMSG_ADD_ITEM_ON_MAP, NETMSG_ERASE_ITEM_FROM_MAP, NETMSG_CRITTER_ACTION, NETMSG_PING,
+        NETMSG_POD_PROPERTY( 8, 0 ), NETMSG_POD_PROPERTY( 8, 1 ), NETMSG_POD_PROPERTY( 8, 2 ),
+        NETMSG_POD_PROPERTY( 2, 0 ), NETMSG_POD_PROPERTY( 2, 1 ), NETMSG_POD_PROPERTY( 2, 2 ),
+        NETMSG_POD_PROPERTY( 1, 0 ), NETMSG_POD_PROPERTY( 1, 1 ), NETMSG_POD_PROPERTY( 1, 2 ),
+        NETMSG_POD_PROPERTY( 4, 0 ), NETMSG_POD_PROPERTY( 4, 1 ), NETMSG_POD_PROPERTY( 4, 2 ),
+        NETMSG_CRITTER_DIR, NETMSG_CRITTER_XY, NETMSG_CRITTER_MOVE,
+    };
+
+    UCharVec dict;
+    for( uint msg : msgs )
+    {
+        uchar data[ sizeof( uint ) * 2 ] = { 0 };
+        memcpy( data, &msg, sizeof( uint ) );
+        dict.insert( dict.end(), data, data + sizeof( data ) );
+    }
+    return dict;
+}
+
+const UCharVec& BufferManager::GetCompressionDictionary()
+{
+    static const UCharVec dict = MakeCompressionDictionary();
+    return dict;
+}
+
 uchar BufferManager::EncryptKey( int move )
 {
     uchar key = 0;
@@ -162,10 +195,21 @@ void BufferManager::Cut( uint len )
         isError = true;
         return;
     }
-    uchar* buf = bufData + bufReadPos;
-    for( uint i = 0; i + bufReadPos + len < bufEndPos; i++ )
-        buf[ i ] = buf[ i + len ];
-    bufEndPos -= len;
+
+    // Consume from front and compact only when most of buffer is already sent,
+    // so draining big backlog by small chunks stays linear
+    bufReadPos += len;
+    if( bufReadPos == bufEndPos )
+    {
+        bufReadPos = 0;
+        bufEndPos = 0;
+    }
+    else if( bufReadPos > bufLen / 2 )
+    {
+        memmove( bufData, bufData + bufReadPos, bufEndPos - bufReadPos );
+        bufEndPos -= bufReadPos;
+        bufReadPos = 0;
+    }
 }
 
 void BufferManager::CopyBuf( const void* from, void* to, uchar crypt_key, uint len )
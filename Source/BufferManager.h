@@ -46,6 +46,7 @@ public:
     uint   GetCurPos()           { return bufReadPos; }
     void   SetEndPos( uint pos ) { bufEndPos = pos; }
     uint   GetEndPos()           { return bufEndPos; }
+    uint   GetUnreadLen()        { return bufEndPos - bufReadPos; }
     void   MoveReadPos( int val );
     bool   IsError()               { return isError; }
     void   SetError()              { isError = true; }
@@ -54,6 +55,9 @@ public:
     bool   NeedProcess();
     void   SkipMsg( uint msg );
 
+    // Preset zlib dictionary shared by server and client
+    static const UCharVec& GetCompressionDictionary();
+
     // Generic specification
     template< typename T >
     BufferManager& operator<<( const T& i )
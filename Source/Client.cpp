@@ -128,6 +128,9 @@ FOClient::FOClient()
     ComBuf = new uchar[ ComLen ];
     ZStreamOk = false;
     Sock = INVALID_SOCKET;
+    UdpSock = INVALID_SOCKET;
+    UdpSession = 0;
+    UdpHelloTick = 0;
     BytesReceive = 0;
     BytesRealReceive = 0;
     BytesSend = 0;
@@ -743,17 +746,73 @@ void FOClient::DeleteCritter( uint remid )
     HexMngr.DeleteCritter( remid );
 }
 
-void FOClient::LookBordersPrepare()
+void FOClient::LookBordersPrepare( bool reuse_traces /* = false */ )
 {
     LookBorders.clear();
     ShootBorders.clear();
 
     if( !Chosen || !HexMngr.IsMapLoaded() || ( !DrawLookBorders && !DrawShootBorders ) )
     {
+        LookBordersHexes.clear();
+        LookBordersKey.clear();
         HexMngr.SetFog( LookBorders, ShootBorders, nullptr, nullptr );
         return;
     }
 
+    // Trace again only if something that affects border hexes was changed
+    UIntVec key = { Chosen->GetHexX(), Chosen->GetHexY(), (uint) Chosen->GetDir(), Chosen->GetLookDistance(), Chosen->GetAttackDist(),
+                    HexMngr.GetWidth(), HexMngr.GetHeight(), (uint) GameOpt.LookChecks, (uint) GameOpt.MapHexagonal,
+                    (uint) DrawLookBorders, (uint) DrawShootBorders };
+    if( !reuse_traces || key != LookBordersKey )
+    {
+        LookBordersTrace();
+        LookBordersKey = key;
+    }
+
+    uint   dist = Chosen->GetLookDistance();
+    ushort base_hx = Chosen->GetHexX();
+    ushort base_hy = Chosen->GetHexY();
+    for( const LookBorderHex& bh : LookBordersHexes )
+    {
+        if( DrawLookBorders )
+        {
+            int    x, y;
+            HexMngr.GetHexCurrentPosition( bh.LookHexX, bh.LookHexY, x, y );
+            short* ox = ( bh.LookDist == dist ? &Chosen->SprOx : nullptr );
+            short* oy = ( bh.LookDist == dist ? &Chosen->SprOy : nullptr );
+            LookBorders.push_back( PrepPoint( x + HEX_OX, y + HEX_OY, COLOR_RGBA( 0, 255, bh.LookDist * 255 / dist, 0 ), ox, oy ) );
+        }
+
+        if( DrawShootBorders )
+        {
+            int    x, y;
+            HexMngr.GetHexCurrentPosition( bh.ShootHexX, bh.ShootHexY, x, y );
+            short* ox = ( bh.ShootDist == bh.MaxShootDist ? &Chosen->SprOx : nullptr );
+            short* oy = ( bh.ShootDist == bh.MaxShootDist ? &Chosen->SprOy : nullptr );
+            ShootBorders.push_back( PrepPoint( x + HEX_OX, y + HEX_OY, COLOR_RGBA( 255, 255, bh.ShootDist * 255 / bh.MaxShootDist, 0 ), ox, oy ) );
+        }
+    }
+
+    int base_x, base_y;
+    HexMngr.GetHexCurrentPosition( base_hx, base_hy, base_x, base_y );
+    if( !LookBorders.empty() )
+    {
+        LookBorders.push_back( *LookBorders.begin() );
+        LookBorders.insert( LookBorders.begin(), PrepPoint( base_x + HEX_OX, base_y + HEX_OY, COLOR_RGBA( 0, 0, 0, 0 ), &Chosen->SprOx, &Chosen->SprOy ) );
+    }
+    if( !ShootBorders.empty() )
+    {
+        ShootBorders.push_back( *ShootBorders.begin() );
+        ShootBorders.insert( ShootBorders.begin(), PrepPoint( base_x + HEX_OX, base_y + HEX_OY, COLOR_RGBA( 255, 0, 0, 0 ), &Chosen->SprOx, &Chosen->SprOy ) );
+    }
+
+    HexMngr.SetFog( LookBorders, ShootBorders, &Chosen->SprOx, &Chosen->SprOy );
+}
+
+void FOClient::LookBordersTrace()
+{
+    LookBordersHexes.clear();
+
     uint   dist = Chosen->GetLookDistance();
     ushort base_hx = Chosen->GetHexX();
     ushort base_hy = Chosen->GetHexY();
@@ -764,6 +823,7 @@ void FOClient::LookBordersPrepare()
     ushort maxhx = HexMngr.GetWidth();
     ushort maxhy = HexMngr.GetHeight();
     bool   seek_start = true;
+    LookBordersHexes.reserve( GameOpt.MapHexagonal ? dist * 6 : dist * 8 );
     for( int i = 0; i < ( GameOpt.MapHexagonal ? 6 : 4 ); i++ )
     {
         int dir = ( GameOpt.MapHexagonal ? ( i + 2 ) % 6 : ( ( i + 1 ) * 2 ) % 8 );
@@ -807,56 +867,36 @@ void FOClient::LookBordersPrepare()
                 hy_ = block.second;
             }
 
-            uint dist_look = DistGame( base_hx, base_hy, hx_, hy_ );
-            if( DrawLookBorders )
-            {
-                int    x, y;
-                HexMngr.GetHexCurrentPosition( hx_, hy_, x, y );
-                short* ox = ( dist_look == dist ? &Chosen->SprOx : nullptr );
-                short* oy = ( dist_look == dist ? &Chosen->SprOy : nullptr );
-                LookBorders.push_back( PrepPoint( x + HEX_OX, y + HEX_OY, COLOR_RGBA( 0, 255, dist_look * 255 / dist, 0 ), ox, oy ) );
-            }
+            LookBorderHex bh;
+            bh.LookHexX = hx_;
+            bh.LookHexY = hy_;
+            bh.LookDist = DistGame( base_hx, base_hy, hx_, hy_ );
+            bh.ShootHexX = hx_;
+            bh.ShootHexY = hy_;
+            bh.ShootDist = 0;
+            bh.MaxShootDist = MAX( MIN( bh.LookDist, dist_shoot ), 0 ) + 1;
 
             if( DrawShootBorders )
             {
-                ushort     hx__ = hx_;
-                ushort     hy__ = hy_;
                 UShortPair block;
-                uint       max_shoot_dist = MAX( MIN( dist_look, dist_shoot ), 0 ) + 1;
-                HexMngr.TraceBullet( base_hx, base_hy, hx_, hy_, max_shoot_dist, 0.0f, nullptr, false, nullptr, 0, nullptr, &block, nullptr, true );
-                hx__ = block.first;
-                hy__ = block.second;
-
-                int    x_, y_;
-                HexMngr.GetHexCurrentPosition( hx__, hy__, x_, y_ );
-                uint   result_shoot_dist = DistGame( base_hx, base_hy, hx__, hy__ );
-                short* ox = ( result_shoot_dist == max_shoot_dist ? &Chosen->SprOx : nullptr );
-                short* oy = ( result_shoot_dist == max_shoot_dist ? &Chosen->SprOy : nullptr );
-                ShootBorders.push_back( PrepPoint( x_ + HEX_OX, y_ + HEX_OY, COLOR_RGBA( 255, 255, result_shoot_dist * 255 / max_shoot_dist, 0 ), ox, oy ) );
+                HexMngr.TraceBullet( base_hx, base_hy, hx_, hy_, bh.MaxShootDist, 0.0f, nullptr, false, nullptr, 0, nullptr, &block, nullptr, true );
+                bh.ShootHexX = block.first;
+                bh.ShootHexY = block.second;
+                bh.ShootDist = DistGame( base_hx, base_hy, bh.ShootHexX, bh.ShootHexY );
             }
-        }
-    }
 
-    int base_x, base_y;
-    HexMngr.GetHexCurrentPosition( base_hx, base_hy, base_x, base_y );
-    if( !LookBorders.empty() )
-    {
-        LookBorders.push_back( *LookBorders.begin() );
-        LookBorders.insert( LookBorders.begin(), PrepPoint( base_x + HEX_OX, base_y + HEX_OY, COLOR_RGBA( 0, 0, 0, 0 ), &Chosen->SprOx, &Chosen->SprOy ) );
-    }
-    if( !ShootBorders.empty() )
-    {
-        ShootBorders.push_back( *ShootBorders.begin() );
-        ShootBorders.insert( ShootBorders.begin(), PrepPoint( base_x + HEX_OX, base_y + HEX_OY, COLOR_RGBA( 255, 0, 0, 0 ), &Chosen->SprOx, &Chosen->SprOy ) );
+            LookBordersHexes.push_back( bh );
+        }
     }
-
-    HexMngr.SetFog( LookBorders, ShootBorders, &Chosen->SprOx, &Chosen->SprOy );
 }
 
 void FOClient::MainLoop()
 {
     Timer::UpdateTick();
 
+    // Sounds
+    SndMngr.Process();
+
     // FPS counter
     static uint last_call = Timer::FastTick();
     static uint call_counter = 0;
@@ -1053,7 +1093,7 @@ void FOClient::MainLoop()
     else if( IsMainScreen( SCREEN_GAME ) && HexMngr.IsMapLoaded() )
     {
         if( HexMngr.Scroll() )
-            LookBordersPrepare();
+            LookBordersPrepare( true );
         CrittersProcess();
         HexMngr.ProcessItems();
         HexMngr.ProcessRain();
@@ -1695,6 +1735,10 @@ void FOClient::NetDisconnect()
     if( Sock != INVALID_SOCKET )
         closesocket( Sock );
     Sock = INVALID_SOCKET;
+    if( UdpSock != INVALID_SOCKET )
+        closesocket( UdpSock );
+    UdpSock = INVALID_SOCKET;
+    UdpSession = 0;
 
     HexMngr.UnloadMap();
     DeleteCritters();
@@ -1716,6 +1760,7 @@ void FOClient::ParseSocket()
     else
     {
         NetProcess();
+        NetUdpProcess();
 
         if( IsConnected && GameOpt.HelpInfo && Bout.IsEmpty() && !PingTick && GameOpt.PingPeriod && Timer::FastTick() >= PingCallTick )
         {
@@ -1839,6 +1884,12 @@ int FOClient::NetInput( bool unpack )
         ZStream.avail_out = Bin.GetLen() - Bin.GetEndPos();
 
         int first_inflate = inflate( &ZStream, Z_SYNC_FLUSH );
+        if( first_inflate == Z_NEED_DICT )
+        {
+            const UCharVec& dict = BufferManager::GetCompressionDictionary();
+            RUNTIME_ASSERT( inflateSetDictionary( &ZStream, &dict[ 0 ], (uint) dict.size() ) == Z_OK );
+            first_inflate = inflate( &ZStream, Z_SYNC_FLUSH );
+        }
         RUNTIME_ASSERT( first_inflate == Z_OK );
 
         uint uncompr = (uint) ( (size_t) ZStream.next_out - (size_t) Bin.GetData() );
@@ -1868,6 +1919,97 @@ int FOClient::NetInput( bool unpack )
     return Bin.GetEndPos() - old_pos;
 }
 
+void FOClient::NetUdpConnect( uint session )
+{
+    #ifndef FO_WEB
+    if( !session || GameOpt.DisableUdp || GameOpt.ProxyType )
+        return;
+
+    if( ( UdpSock = socket( PF_INET, SOCK_DGRAM, IPPROTO_UDP ) ) == INVALID_SOCKET )
+    {
+        WriteLog( "Create udp socket error '{}'.\n", GetLastSocketError() );
+        return;
+    }
+
+    #ifdef FO_WINDOWS
+    unsigned long mode = 1;
+    if( ioctlsocket( UdpSock, FIONBIO, &mode ) )
+    #else
+    int flags = fcntl( UdpSock, F_GETFL, 0 );
+    RUNTIME_ASSERT( flags >= 0 );
+    if( fcntl( UdpSock, F_SETFL, flags | O_NONBLOCK ) )
+    #endif
+    {
+        WriteLog( "Can't set non-blocking mode to udp socket, error '{}'.\n", GetLastSocketError() );
+        closesocket( UdpSock );
+        UdpSock = INVALID_SOCKET;
+        return;
+    }
+
+    // Server listens same port number, connected socket also filters out foreign datagrams
+    if( connect( UdpSock, (sockaddr*) &SockAddr, sizeof( sockaddr_in ) ) )
+    {
+        WriteLog( "Can't connect udp socket, error '{}'.\n", GetLastSocketError() );
+        closesocket( UdpSock );
+        UdpSock = INVALID_SOCKET;
+        return;
+    }
+
+    UdpSession = session;
+    UdpHelloTick = 0;
+    #endif
+}
+
+void FOClient::NetUdpProcess()
+{
+    if( UdpSock == INVALID_SOCKET )
+        return;
+
+    // Until hello reached server all data goes through reliable channel
+    if( Timer::FastTick() >= UdpHelloTick )
+    {
+        send( UdpSock, (char*) &UdpSession, sizeof( UdpSession ), 0 );
+        UdpHelloTick = Timer::FastTick() + UDP_HELLO_TIME;
+    }
+
+    // Each datagram is single message, lost or reordered ones are handled by sequence
+    uchar data[ NETMSG_CRITTER_MOVE_SIZE + 1 ];
+    while( UdpSock != INVALID_SOCKET )
+    {
+        int len = (int) recv( UdpSock, (char*) data, sizeof( data ), 0 );
+        if( len <= 0 )
+            break;
+
+        BytesReceive += len;
+        BytesRealReceive += len;
+
+        if( GameOpt.UdpSimulatedLoss && Random( 0, 99 ) < (int) GameOpt.UdpSimulatedLoss )
+            continue;
+
+        uint msg;
+        memcpy( &msg, data, sizeof( msg ) );
+        if( len != NETMSG_CRITTER_MOVE_SIZE || msg != NETMSG_CRITTER_MOVE )
+            continue;
+
+        uint   crid;
+        uint   move_params;
+        ushort new_hx;
+        ushort new_hy;
+        uint   seq;
+        uchar* ptr = data + sizeof( msg );
+        memcpy( &crid, ptr, sizeof( crid ) );
+        ptr += sizeof( crid );
+        memcpy( &move_params, ptr, sizeof( move_params ) );
+        ptr += sizeof( move_params );
+        memcpy( &new_hx, ptr, sizeof( new_hx ) );
+        ptr += sizeof( new_hx );
+        memcpy( &new_hy, ptr, sizeof( new_hy ) );
+        ptr += sizeof( new_hy );
+        memcpy( &seq, ptr, sizeof( seq ) );
+        OnCritterMove( crid, move_params, new_hx, new_hy, seq );
+    }
+}
+
 void FOClient::NetProcess()
 {
     while( IsConnected && Bin.NeedProcess() )
@@ -2335,8 +2477,10 @@ void FOClient::Net_OnLoginSuccess()
     uint bin_seed, bout_seed;         // Server bin/bout == client bout/bin
 
     Bin >> msg_len;
+    uint udp_session;
     Bin >> bin_seed;
     Bin >> bout_seed;
+    Bin >> udp_session;
     NET_READ_PROPERTIES( Bin, GlovalVarsPropertiesData );
 
     CHECK_IN_BUFF_ERROR;
@@ -2344,6 +2488,7 @@ void FOClient::Net_OnLoginSuccess()
     Bout.SetEncryptKey( bin_seed );
     Bin.SetEncryptKey( bout_seed );
     Globals->Props.RestoreData( GlovalVarsPropertiesData );
+    NetUdpConnect( udp_session );
 }
 
 void FOClient::Net_OnAddCritter( bool is_npc )
@@ -2772,13 +2917,20 @@ void FOClient::Net_OnCritterMove()
     uint   move_params;
     ushort new_hx;
     ushort new_hy;
+    uint   seq;
     Bin >> crid;
     Bin >> move_params;
     Bin >> new_hx;
     Bin >> new_hy;
+    Bin >> seq;
 
     CHECK_IN_BUFF_ERROR;
 
+    OnCritterMove( crid, move_params, new_hx, new_hy, seq );
+}
+
+void FOClient::OnCritterMove( uint crid, uint move_params, ushort new_hx, ushort new_hy, uint seq )
+{
     if( new_hx >= HexMngr.GetWidth() || new_hy >= HexMngr.GetHeight() )
         return;
 
@@ -2786,6 +2938,14 @@ void FOClient::Net_OnCritterMove()
     if( !cr )
         return;
 
+    // Skip reordered datagrams and reliable messages outrun by newer datagrams
+    if( seq )
+    {
+        if( seq <= cr->MoveSeq )
+            return;
+        cr->MoveSeq = seq;
+    }
+
     cr->IsRunning = FLAG( move_params, MOVE_PARAM_RUN );
 
     if( cr != Chosen )
@@ -3100,10 +3260,12 @@ void FOClient::Net_OnCritterXY()
     ushort hx;
     ushort hy;
     uchar  dir;
+    uint   seq;
     Bin >> crid;
     Bin >> hx;
     Bin >> hy;
     Bin >> dir;
+    Bin >> seq;
 
     CHECK_IN_BUFF_ERROR;
 
@@ -3117,6 +3279,13 @@ void FOClient::Net_OnCritterXY()
     if( !cr )
         return;
 
+    if( seq )
+    {
+        if( seq <= cr->MoveSeq )
+            return;
+        cr->MoveSeq = seq;
+    }
+
     if( hx >= HexMngr.GetWidth() || hy >= HexMngr.GetHeight() || dir >= DIRS_COUNT )
     {
         WriteLog( "Error data, hx {}, hy {}, dir {}.\n", hx, hy, dir );
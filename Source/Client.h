@@ -143,6 +143,9 @@ public:
     sockaddr_in   SockAddr, ProxyAddr;
     SOCKET        Sock;
     fd_set        SockSet;
+    SOCKET        UdpSock;
+    uint          UdpSession;
+    uint          UdpHelloTick;
     Item*         SomeItem;
     bool          IsConnecting;
     bool          IsConnected;
@@ -161,6 +164,8 @@ public:
     int  NetInput( bool unpack );
     bool NetOutput();
     void NetProcess();
+    void NetUdpConnect( uint session );
+    void NetUdpProcess();
 
     void Net_SendUpdate();
     void Net_SendLogIn();
@@ -198,6 +203,7 @@ public:
 
     void Net_OnCritterDir();
     void Net_OnCritterMove();
+    void OnCritterMove( uint crid, uint move_params, ushort new_hx, ushort new_hy, uint seq );
     void Net_OnSomeItem();
     void Net_OnCritterAction();
     void Net_OnCritterMoveItem();
@@ -647,7 +653,20 @@ public:
     bool     DrawLookBorders, DrawShootBorders;
     PointVec LookBorders, ShootBorders;
 
-    void LookBordersPrepare();
+    // Traced border hexes, scrolling only moves them on screen
+    struct LookBorderHex
+    {
+        ushort LookHexX, LookHexY;
+        uint   LookDist;
+        ushort ShootHexX, ShootHexY;
+        uint   ShootDist, MaxShootDist;
+    };
+    typedef vector< LookBorderHex > LookBorderHexVec;
+    LookBorderHexVec LookBordersHexes;
+    UIntVec          LookBordersKey;
+
+    void LookBordersPrepare( bool reuse_traces = false );
+    void LookBordersTrace();
 
 /************************************************************************/
 /* MessBox                                                              */
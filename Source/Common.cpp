@@ -887,6 +887,8 @@ void GetClientOptions()
     GETOPTIONS_CHECK( GameOpt.ScreenHeight, 100, 30000, 600 );
     GameOpt.AlwaysOnTop = MainConfig->GetInt( "", "AlwaysOnTop", false ) != 0;
     GETOPTIONS_CMD_LINE_BOOL( GameOpt.AlwaysOnTop, "AlwaysOnTop" );
+    GameOpt.SpriteCache = MainConfig->GetInt( "", "SpriteCache", false ) != 0;
+    GETOPTIONS_CMD_LINE_BOOL( GameOpt.SpriteCache, "SpriteCache" );
     GameOpt.FixedFPS = MainConfig->GetInt( "", "FixedFPS", 100 );
     GETOPTIONS_CMD_LINE_INT( GameOpt.FixedFPS, "FixedFPS" );
     GETOPTIONS_CHECK( GameOpt.FixedFPS, -10000, 10000, 100 );
@@ -1114,8 +1116,16 @@ GameOptions::GameOptions()
     GameTimeTick = 0;
 
     DisableTcpNagle = false;
+    DisableUdp = false;
+    UdpSimulatedLoss = 0;
     DisableZlibCompression = false;
+    ZlibCompressionLevel = 1;
+    ZlibCompressionMinSize = 0;
+    ZlibCompressionDictionary = true;
     FloodSize = 2048;
+    NetBufferHighWatermark = 262144;
+    NetBufferLowWatermark = 65536;
+    NetBufferLimit = 4194304;
     NoAnswerShuffle = false;
     DialogDemandRecheck = false;
     SneakDivider = 6;
@@ -1155,6 +1165,10 @@ GameOptions::GameOptions()
     DlgTalkMinTime = 0;
     DlgBarterMinTime = 0;
     MinimumOfflineTime = 180000;
+    MoveInterestNearDist = 10;
+    MoveInterestFarDist = 20;
+    MapHibernationTime = 0;
+    ItemVisibilityValidation = false;
     ForceRebuildResources = false;
 
     MapHexagonal = true;
@@ -1269,6 +1283,7 @@ GameOptions::GameOptions()
     MessNotify = true;
     SoundNotify = true;
     AlwaysOnTop = false;
+    SpriteCache = false;
     TextDelay = 3000;
     DamageHitDelay = 0;
     ScreenWidth = 800;
@@ -411,6 +411,8 @@ struct ServerScriptFunctions
     void* ItemCheckMove;
 
     void* StaticItemWalk;
+
+    void* IpcMessage;
 } extern ServerFunctions;
 
 #endif
@@ -431,8 +433,16 @@ struct GameOptions
     uint   GameTimeTick;
 
     bool   DisableTcpNagle;
+    bool   DisableUdp;
+    uint   UdpSimulatedLoss;
     bool   DisableZlibCompression;
+    int    ZlibCompressionLevel;
+    uint   ZlibCompressionMinSize;
+    bool   ZlibCompressionDictionary;
     uint   FloodSize;
+    uint   NetBufferHighWatermark;
+    uint   NetBufferLowWatermark;
+    uint   NetBufferLimit;
     bool   NoAnswerShuffle;
     bool   DialogDemandRecheck;
     uint   SneakDivider;
@@ -463,6 +473,10 @@ struct GameOptions
     uint   DlgTalkMinTime;
     uint   DlgBarterMinTime;
     uint   MinimumOfflineTime;
+    uint   MoveInterestNearDist;
+    uint   MoveInterestFarDist;
+    uint   MapHibernationTime;
+    bool   ItemVisibilityValidation;
     bool   ForceRebuildResources;
 
     bool   MapHexagonal;
@@ -544,6 +558,7 @@ struct GameOptions
     bool   MessNotify;
     bool   SoundNotify;
     bool   AlwaysOnTop;
+    bool   SpriteCache;
     uint   TextDelay;
     uint   DamageHitDelay;
     int    ScreenWidth;
@@ -731,4 +746,25 @@ T* ReadDataArr( UCharVec& vec, uint size, uint& pos )
     return size ? &vec[ pos - size ] : nullptr;
 }
 
+// Bounds checked variants for untrusted data
+template< class T >
+bool ReadDataSafe( UCharVec& vec, uint& pos, T& data )
+{
+    if( (size_t) pos + sizeof( T ) > vec.size() )
+        return false;
+    memcpy( &data, &vec[ pos ], sizeof( T ) );
+    pos += sizeof( T );
+    return true;
+}
+
+template< class T >
+bool ReadDataArrSafe( UCharVec& vec, uint size, uint& pos, T*& data )
+{
+    if( (size_t) pos + size > vec.size() )
+        return false;
+    data = ( size ? (T*) &vec[ pos ] : nullptr );
+    pos += size;
+    return true;
+}
+
 #endif // __COMMON__
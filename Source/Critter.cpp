@@ -95,6 +95,7 @@ Critter::Critter( uint id, EntityType type, ProtoCritter* proto ): Entity( id, t
     Flags = 0;
     LockMapTransfers = 0;
     ViewMapId = 0;
+    VisItemLook = -1;
     ViewMapPid = 0;
     ViewMapLook = 0;
     ViewMapHx = ViewMapHy = 0;
@@ -104,6 +105,8 @@ Critter::Critter( uint id, EntityType type, ProtoCritter* proto ): Entity( id, t
     Name = "";
     memzero( &Moving, sizeof( Moving ) );
     Moving.State = 1;
+    MoveInterestStep = 0;
+    MoveInterestTick = 0;
 }
 
 Critter::~Critter()
@@ -587,51 +590,131 @@ void Critter::ProcessVisibleItems()
         return;
 
     int look = GetLookDistance();
+    VisItemLook = look;
     for( Item* item : map->GetItems() )
+        ProcessVisibleItem( map, item, look );
+}
+
+void Critter::ProcessVisibleItemsStep( ushort from_hx, ushort from_hy )
+{
+    if( IsDestroyed )
+        return;
+
+    Map* map = MapMngr.GetMap( GetMapId() );
+    if( !map )
+        return;
+
+    // Fallback to full rescan if view range changed not by one step
+    ushort hx = GetHexX();
+    ushort hy = GetHexY();
+    int    look = GetLookDistance();
+    if( look != VisItemLook || look <= 0 || DistGame( from_hx, from_hy, hx, hy ) > 1 )
     {
-        if( item->GetIsHidden() )
+        ProcessVisibleItems();
+        return;
+    }
+
+    // Always visible items and traps checked regardless of distance
+    for( Item* item : map->GetSpecialViewItems() )
+        ProcessVisibleItem( map, item, look );
+
+    // Entering and leaving hexes lie on border of old and new view ranges
+    if( hx != from_hx || hy != from_hy )
+    {
+        ProcessVisibleItemsRing( map, hx, hy, from_hx, from_hy, look );
+        ProcessVisibleItemsRing( map, from_hx, from_hy, hx, hy, look );
+    }
+
+    // Compare with full rescan
+    if( GameOpt.ItemVisibilityValidation )
+    {
+        uint mismatches = 0;
+        for( Item* item : map->GetItems() )
+            if( ProcessVisibleItem( map, item, look ) )
+                mismatches++;
+        if( mismatches )
+            WriteLog( "Item visibility of critter '{}' mismatched with full rescan, fixed {} items.\n", GetName(), mismatches );
+    }
+}
+
+bool Critter::ProcessVisibleItem( Map* map, Item* item, int look )
+{
+    if( item->GetIsHidden() )
+    {
+        return false;
+    }
+    else if( item->GetIsAlwaysView() )
+    {
+        if( AddIdVisItem( item->GetId() ) )
         {
-            continue;
+            Send_AddItemOnMap( item );
+            Script::RaiseInternalEvent( ServerFunctions.CritterShowItemOnMap, this, item, item->ViewPlaceOnMap, item->ViewByCritter );
+            return true;
         }
-        else if( item->GetIsAlwaysView() )
+    }
+    else
+    {
+        bool allowed = false;
+        if( item->GetIsTrap() && FLAG( GameOpt.LookChecks, LOOK_CHECK_ITEM_SCRIPT ) )
+        {
+            allowed = Script::RaiseInternalEvent( ServerFunctions.MapCheckTrapLook, map, this, item );
+        }
+        else
+        {
+            int dist = DistGame( GetHexX(), GetHexY(), item->GetHexX(), item->GetHexY() );
+            if( item->GetIsTrap() )
+                dist += item->GetTrapValue();
+            allowed = look >= dist;
+        }
+
+        if( allowed )
         {
             if( AddIdVisItem( item->GetId() ) )
             {
                 Send_AddItemOnMap( item );
                 Script::RaiseInternalEvent( ServerFunctions.CritterShowItemOnMap, this, item, item->ViewPlaceOnMap, item->ViewByCritter );
+                return true;
             }
         }
         else
         {
-            bool allowed = false;
-            if( item->GetIsTrap() && FLAG( GameOpt.LookChecks, LOOK_CHECK_ITEM_SCRIPT ) )
-            {
-                allowed = Script::RaiseInternalEvent( ServerFunctions.MapCheckTrapLook, map, this, item );
-            }
-            else
+            if( DelIdVisItem( item->GetId() ) )
             {
-                int dist = DistGame( GetHexX(), GetHexY(), item->GetHexX(), item->GetHexY() );
-                if( item->GetIsTrap() )
-                    dist += item->GetTrapValue();
-                allowed = look >= dist;
+                Send_EraseItemFromMap( item );
+                Script::RaiseInternalEvent( ServerFunctions.CritterHideItemOnMap, this, item, item->ViewPlaceOnMap, item->ViewByCritter );
+                return true;
             }
+        }
+    }
+    return false;
+}
 
-            if( allowed )
-            {
-                if( AddIdVisItem( item->GetId() ) )
-                {
-                    Send_AddItemOnMap( item );
-                    Script::RaiseInternalEvent( ServerFunctions.CritterShowItemOnMap, this, item, item->ViewPlaceOnMap, item->ViewByCritter );
-                }
-            }
-            else
-            {
-                if( DelIdVisItem( item->GetId() ) )
-                {
-                    Send_EraseItemFromMap( item );
-                    Script::RaiseInternalEvent( ServerFunctions.CritterHideItemOnMap, this, item, item->ViewPlaceOnMap, item->ViewByCritter );
-                }
-            }
+void Critter::ProcessVisibleItemsRing( Map* map, ushort hx, ushort hy, ushort exclude_hx, ushort exclude_hy, int look )
+{
+    // Walk hexes at look distance from hx, hy which are out of look range from exclude_hx, exclude_hy
+    int     maxhx = map->GetWidth();
+    int     maxhy = map->GetHeight();
+    int     rx = hx;
+    int     ry = hy;
+    ItemVec items;
+    for( int i = 0; i < look; i++ )
+        MoveHexByDirUnsafe( rx, ry, GameOpt.MapHexagonal ? 0 : 7 );
+    for( int i = 0, ii = ( GameOpt.MapHexagonal ? 6 : 4 ); i < ii; i++ )
+    {
+        int dir = ( GameOpt.MapHexagonal ? ( i + 2 ) % 6 : ( ( i + 1 ) * 2 ) % 8 );
+        for( int j = 0, jj = ( GameOpt.MapHexagonal ? look : look * 2 ); j < jj; j++ )
+        {
+            MoveHexByDirUnsafe( rx, ry, dir );
+            if( rx < 0 || ry < 0 || rx >= maxhx || ry >= maxhy )
+                continue;
+            if( (int) DistGame( exclude_hx, exclude_hy, rx, ry ) <= look )
+                continue;
+
+            items.clear();
+            map->GetItemsHex( rx, ry, items );
+            for( Item* item : items )
+                if( !item->GetIsAlwaysView() && !item->GetIsTrap() && item->GetMapId() == map->GetId() )
+                    ProcessVisibleItem( map, item, look );
         }
     }
 }
@@ -1313,12 +1396,67 @@ void Critter::SendA_Move( uint move_params )
     if( VisCr.empty() )
         return;
 
+    // Last step of path always sent to all
+    bool is_last_step = ( !FLAG( move_params, MOVE_PARAM_STEP_ALLOW ) || FLAG( move_params, MOVE_PARAM_STEP_DISALLOW ) );
+
+    MoveInterestStep++;
     for( auto it = VisCr.begin(), end = VisCr.end(); it != end; ++it )
     {
         Critter* cr = *it;
         if( cr->IsPlayer() )
-            cr->Send_Move( this, move_params );
+        {
+            uint rate = ( is_last_step ? 1 : GetMoveInterestRate( cr ) );
+            if( rate <= 1 || MoveInterestStep % rate == 0 )
+            {
+                cr->Send_Move( this, move_params );
+                if( !MoveInterestPending.empty() )
+                    MoveInterestPending.erase( cr->GetId() );
+            }
+            else
+            {
+                MoveInterestPending.insert( cr->GetId() );
+            }
+        }
     }
+
+    if( !MoveInterestPending.empty() )
+        MoveInterestTick = Timer::GameTick();
+}
+
+uint Critter::GetMoveInterestRate( Critter* viewer )
+{
+    if( !GameOpt.MoveInterestNearDist )
+        return 1;
+
+    // Combat participants receive all steps
+    if( IS_TIMEOUT( GetTimeoutBattle() ) || IS_TIMEOUT( viewer->GetTimeoutBattle() ) || Moving.TargId == viewer->GetId() )
+        return 1;
+
+    uint dist = DistGame( GetHexX(), GetHexY(), viewer->GetHexX(), viewer->GetHexY() );
+    if( dist <= GameOpt.MoveInterestNearDist )
+        return 1;
+    if( dist <= GameOpt.MoveInterestFarDist )
+        return 2;
+    return 4;
+}
+
+void Critter::ProcessMoveInterest()
+{
+    if( MoveInterestPending.empty() )
+        return;
+
+    // Wait until movement stops, then send final position to viewers that skipped last steps
+    uint step_time = ( IsRunning ? GetRunTime() : GetWalkTime() );
+    if( Timer::GameTick() - MoveInterestTick < step_time * 2 )
+        return;
+
+    for( uint id : MoveInterestPending )
+    {
+        auto it = VisCrMap.find( id );
+        if( it != VisCrMap.end() )
+            it->second->Send_XY( this );
+    }
+    MoveInterestPending.clear();
 }
 
 void Critter::SendA_XY()
@@ -1808,6 +1946,8 @@ Client::Client( NetConnection* conn, ProtoCritter* proto ): Critter( 0, EntityTy
     LastActivityTime = Timer::FastTick();
     LastSay[ 0 ] = 0;
     LastSayEqualCount = 0;
+    outBufCongested = false;
+    MoveSeq = 0;
 }
 
 Client::~Client()
@@ -1885,6 +2025,52 @@ void Client::PingOk( uint next_ping )
     pingNextTick = Timer::FastTick() + next_ping;
 }
 
+uint Client::GetOutBufLen()
+{
+    Connection->Bout.Lock();
+    uint len = Connection->Bout.GetUnreadLen();
+    Connection->Bout.Unlock();
+    return len;
+}
+
+void Client::ProcessOutBuf()
+{
+    if( IsOffline() )
+        return;
+
+    uint len = GetOutBufLen();
+
+    // Client can't keep up at all, drop it before backlog eats server memory
+    if( GameOpt.NetBufferLimit && len > GameOpt.NetBufferLimit )
+    {
+        WriteLog( "Output buffer overflow ({} bytes), client '{}'. Disconnect.\n", len, GetName() );
+        Connection->Bout.LockReset();
+        Connection->Disconnect();
+        return;
+    }
+
+    // Congestion with hysteresis between watermarks
+    if( !GameOpt.NetBufferHighWatermark )
+        outBufCongested = false;
+    else if( !outBufCongested )
+        outBufCongested = ( len >= GameOpt.NetBufferHighWatermark );
+    else
+        outBufCongested = ( len > GameOpt.NetBufferLowWatermark );
+
+    // Resync critters which moves was coalesced during congestion
+    if( !outBufCongested && !outBufCoalesced.empty() )
+    {
+        UIntSet coalesced;
+        coalesced.swap( outBufCoalesced );
+        for( uint crid : coalesced )
+        {
+            auto it = VisCrSelfMap.find( crid );
+            if( it != VisCrSelfMap.end() )
+                Send_XY( it->second );
+        }
+    }
+}
+
 void Client::Send_AddCritter( Critter* cr )
 {
     if( IsSendDisabled() || IsOffline() )
@@ -2092,12 +2278,46 @@ void Client::Send_Move( Critter* from_cr, uint move_params )
     if( IsSendDisabled() || IsOffline() )
         return;
 
+    // Only last position matters for slow client, send it when buffer drains
+    if( outBufCongested && from_cr != this )
+    {
+        outBufCoalesced.insert( from_cr->GetId() );
+        return;
+    }
+    if( !outBufCoalesced.empty() )
+        outBufCoalesced.erase( from_cr->GetId() );
+
+    uint   msg = NETMSG_CRITTER_MOVE;
+    uint   crid = from_cr->GetId();
+    ushort hx = from_cr->GetHexX();
+    ushort hy = from_cr->GetHexY();
+    uint   seq = ( Connection->UdpSession ? ++MoveSeq : 0 );
+
+    // Intermediate steps are superseded by next ones, so loss is acceptable for them,
+    // last step always goes through reliable channel
+    bool is_last_step = ( !FLAG( move_params, MOVE_PARAM_STEP_ALLOW ) || FLAG( move_params, MOVE_PARAM_STEP_DISALLOW ) );
+    if( seq && !is_last_step && from_cr != this )
+    {
+        uchar  data[ NETMSG_CRITTER_MOVE_SIZE ];
+        uchar* ptr = data;
+        auto   write = [ &ptr ] ( const void * value, uint size ) { memcpy( ptr, value, size ); ptr += size; };
+        write( &msg, sizeof( msg ) );
+        write( &crid, sizeof( crid ) );
+        write( &move_params, sizeof( move_params ) );
+        write( &hx, sizeof( hx ) );
+        write( &hy, sizeof( hy ) );
+        write( &seq, sizeof( seq ) );
+        if( Connection->SendUdp( data, sizeof( data ) ) )
+            return;
+    }
+
     BOUT_BEGIN( this );
-    Connection->Bout << NETMSG_CRITTER_MOVE;
-    Connection->Bout << from_cr->GetId();
+    Connection->Bout << msg;
+    Connection->Bout << crid;
     Connection->Bout << move_params;
-    Connection->Bout << from_cr->GetHexX();
-    Connection->Bout << from_cr->GetHexY();
+    Connection->Bout << hx;
+    Connection->Bout << hy;
+    Connection->Bout << seq;
     BOUT_END( this );
 }
 
@@ -2106,6 +2326,19 @@ void Client::Send_Dir( Critter* from_cr )
     if( IsSendDisabled() || IsOffline() )
         return;
 
+    if( outBufCongested && from_cr != this )
+    {
+        outBufCoalesced.insert( from_cr->GetId() );
+        return;
+    }
+
+    // Pending resync carries direction too, send it now instead of leaving stale slot behind
+    if( !outBufCoalesced.empty() && outBufCoalesced.erase( from_cr->GetId() ) )
+    {
+        Send_XY( from_cr );
+        return;
+    }
+
     BOUT_BEGIN( this );
     Connection->Bout << NETMSG_CRITTER_DIR;
     Connection->Bout << from_cr->GetId();
@@ -2463,12 +2696,15 @@ void Client::Send_XY( Critter* cr )
     if( IsSendDisabled() || IsOffline() )
         return;
 
+    uint seq = ( Connection->UdpSession ? ++MoveSeq : 0 );
+
     BOUT_BEGIN( this );
     Connection->Bout << NETMSG_CRITTER_XY;
     Connection->Bout << cr->GetId();
     Connection->Bout << cr->GetHexX();
     Connection->Bout << cr->GetHexY();
     Connection->Bout << cr->GetDir();
+    Connection->Bout << seq;
     BOUT_END( this );
 }
 
@@ -2875,7 +3111,7 @@ void Client::Send_AutomapsInfo( void* locs_vec, Location* loc )
 
 void Client::Send_Effect( hash eff_pid, ushort hx, ushort hy, ushort radius )
 {
-    if( IsSendDisabled() || IsOffline() )
+    if( IsSendDisabled() || IsOffline() || outBufCongested )
         return;
 
     BOUT_BEGIN( this );
@@ -2889,7 +3125,7 @@ void Client::Send_Effect( hash eff_pid, ushort hx, ushort hy, ushort radius )
 
 void Client::Send_FlyEffect( hash eff_pid, uint from_crid, uint to_crid, ushort from_hx, ushort from_hy, ushort to_hx, ushort to_hy )
 {
-    if( IsSendDisabled() || IsOffline() )
+    if( IsSendDisabled() || IsOffline() || outBufCongested )
         return;
 
     BOUT_BEGIN( this );
@@ -2906,7 +3142,7 @@ void Client::Send_FlyEffect( hash eff_pid, uint from_crid, uint to_crid, ushort
 
 void Client::Send_PlaySound( uint crid_synchronize, const string& sound_name )
 {
-    if( IsSendDisabled() || IsOffline() )
+    if( IsSendDisabled() || IsOffline() || outBufCongested )
         return;
 
     uint msg_len = sizeof( uint ) + sizeof( msg_len ) + sizeof( crid_synchronize ) +
@@ -15,6 +15,7 @@
 #define STATE_CONNECTED       ( 1 )
 #define STATE_PLAYING         ( 2 )
 #define STATE_TRANSFERRING    ( 3 )
+#define STATE_AUTHENTICATING  ( 4 )
 
 class Critter;
 class Client;
@@ -130,6 +131,7 @@ public:
     UIntSet VisCr1, VisCr2, VisCr3;
     UIntSet VisItem;
     Mutex   VisItemLocker;
+    int     VisItemLook;
     uint    ViewMapId;
     hash    ViewMapPid;
     ushort  ViewMapLook, ViewMapHx, ViewMapHy;
@@ -140,6 +142,9 @@ public:
 
     void ProcessVisibleCritters();
     void ProcessVisibleItems();
+    void ProcessVisibleItemsStep( ushort from_hx, ushort from_hy );
+    bool ProcessVisibleItem( Map* map, Item* item, int look );
+    void ProcessVisibleItemsRing( Map* map, ushort hx, ushort hy, ushort exclude_hx, ushort exclude_hy, int look );
     void ViewMap( Map* map, int look, ushort hx, ushort hy, int dir );
     void ClearVisible();
 
@@ -272,6 +277,13 @@ public:
     void SendA_Dir();
     void SendA_CustomCommand( ushort num_param, int val );
 
+    // Movement interest management
+    uint    MoveInterestStep;
+    uint    MoveInterestTick;
+    UIntSet MoveInterestPending;
+    uint GetMoveInterestRate( Critter* viewer );
+    void ProcessMoveInterest();
+
     // Chosen data
     void Send_AddAllItems();
     void Send_AllAutomapsInfo();
@@ -327,6 +339,7 @@ public:
     uint           RadioMessageSended;
     int            UpdateFileIndex;
     uint           UpdateFilePortion;
+    uint           MoveSeq;
 
 public:
     uint        GetIp();
@@ -348,6 +361,16 @@ public:
     void PingClient();
     void PingOk( uint next_ping );
 
+    // Output buffer backpressure
+private:
+    bool    outBufCongested;
+    UIntSet outBufCoalesced;
+
+public:
+    uint GetOutBufLen();
+    bool IsOutBufCongested() { return outBufCongested; }
+    void ProcessOutBuf();
+
     // Sends
 public:
     void Send_Property( NetProperty::Type type, Property* prop, Entity* entity );
@@ -73,6 +73,7 @@ CritterCl::CritterCl( uint id, ProtoCritter* proto ): Entity( id, EntityType::Cr
     needReSet = false;
     reSetTick = 0;
     CurMoveStep = 0;
+    MoveSeq = 0;
     Visible = true;
     SprDrawValid = false;
     OxExtI = OyExtI = 0;
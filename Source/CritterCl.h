@@ -117,6 +117,7 @@ public:
     bool          IsRunning;
     UShortPairVec MoveSteps;
     int           CurMoveStep;
+    uint          MoveSeq;
     bool IsNeedMove() { return MoveSteps.size() && !IsWalkAnim(); }
     void Move( int dir );
 
@@ -337,14 +337,22 @@ void CryptManager::EraseCache( const string& data_name )
     }
 }
 
-void CryptManager::SetCache( const string& data_name, const uchar* data, uint data_len )
+void CryptManager::SetCache( const string& data_name, const uchar* data, uint data_len, bool commit /* = true */ )
 {
     RUNTIME_ASSERT( CacheDb );
 
     int r = unqlite_kv_store( CacheDb, data_name.c_str(), (int) data_name.length(), data, data_len );
     RUNTIME_ASSERT( r == UNQLITE_OK );
 
-    r = unqlite_commit( CacheDb );
+    if( commit )
+        CommitCache();
+}
+
+void CryptManager::CommitCache()
+{
+    RUNTIME_ASSERT( CacheDb );
+
+    int r = unqlite_commit( CacheDb );
     RUNTIME_ASSERT( r == UNQLITE_OK );
 }
 
@@ -21,7 +21,8 @@ public:
     bool   InitCache();
     bool   IsCache( const string& data_name );
     void   EraseCache( const string& data_name );
-    void   SetCache( const string& data_name, const uchar* data, uint data_len );
+    void   SetCache( const string& data_name, const uchar* data, uint data_len, bool commit = true );
+    void   CommitCache();
     void   SetCache( const string& data_name, const string& str );
     void   SetCache( const string& data_name, UCharVec& data );
     uchar* GetCache( const string& data_name, uint& data_len );
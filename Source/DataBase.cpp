@@ -332,16 +332,126 @@ static void BsonToDocument( const bson_t* bson, DataBase::Document& doc )
     }
 }
 
+static void ParallelFor( size_t count, std::function< void(size_t) > job )
+{
+    // Small amounts not worth threads creation
+    uint threads_count = MIN( std::thread::hardware_concurrency(), 16U );
+    if( threads_count <= 1 || count < 64 )
+    {
+        for( size_t i = 0; i < count; i++ )
+            job( i );
+        return;
+    }
+
+    // Asserts in jobs must be reported on caller thread, workers have no handlers
+    Mutex              index_locker;
+    size_t             next_index = 0;
+    std::exception_ptr job_error;
+    auto               worker = [ &index_locker, &next_index, &job_error, &job, count ] ( void* )
+    {
+        while( true )
+        {
+            index_locker.Lock();
+            size_t i = ( job_error ? count : next_index++ );
+            index_locker.Unlock();
+            if( i >= count )
+                break;
+
+            try
+            {
+                job( i );
+            }
+            catch( ... )
+            {
+                SCOPE_LOCK( index_locker );
+                if( !job_error )
+                    job_error = std::current_exception();
+            }
+        }
+    };
+
+    vector< Thread* > threads;
+    for( uint i = 0; i < threads_count; i++ )
+    {
+        threads.push_back( new Thread() );
+        threads.back()->Start( worker, _str( "DbLoad{}", i ) );
+    }
+    for( Thread* thread : threads )
+    {
+        thread->Wait();
+        delete thread;
+    }
+
+    if( job_error )
+        std::rethrow_exception( job_error );
+}
+
+void DataBase::GetAllRecords( const string& collection_name, Collection& records )
+{
+    for( uint id : GetAllRecordIds( collection_name ) )
+        records[ id ] = GetRecord( collection_name, id );
+}
+
+UIntVec DataBase::GetAllIds( const string& collection_name )
+{
+    SCOPE_LOCK( backendLocker );
+
+    return GetAllRecordIds( collection_name );
+}
+
+DataBase::Collection DataBase::GetAll( const string& collection_name )
+{
+    SCOPE_LOCK( backendLocker );
+
+    Collection records;
+    GetAllRecords( collection_name, records );
+
+    SCOPE_LOCK( changesLocker );
+
+    // Apply not committed changes, new records not listed same as in GetAllIds
+    auto deleted_it = deletedRecords.find( collection_name );
+    if( deleted_it != deletedRecords.end() )
+        for( uint id : deleted_it->second )
+            records.erase( id );
+
+    auto changes_it = recordChanges.find( collection_name );
+    if( changes_it != recordChanges.end() )
+    {
+        for( auto& changes : changes_it->second )
+        {
+            auto it = records.find( changes.first );
+            if( it != records.end() )
+                for( auto& kv : changes.second )
+                    it->second[ kv.first ] = kv.second;
+        }
+    }
+
+    return records;
+}
+
 DataBase::Document DataBase::Get( const string& collection_name, uint id )
 {
-    if( deletedRecords[ collection_name ].count( id ) )
-        return Document();
+    // Hold backend until changes applied, so commit can't happen in between
+    SCOPE_LOCK( backendLocker );
+
+    {
+        SCOPE_LOCK( changesLocker );
+
+        if( deletedRecords[ collection_name ].count( id ) )
+            return Document();
 
-    if( newRecords[ collection_name ].count( id ) )
-        return recordChanges[ collection_name ][ id ];
+        if( newRecords[ collection_name ].count( id ) )
+            return recordChanges[ collection_name ][ id ];
+    }
 
+    // Read without changes lock, logic thread may continue to record changes
     Document doc = GetRecord( collection_name, id );
 
+    SCOPE_LOCK( changesLocker );
+
+    if( deletedRecords[ collection_name ].count( id ) )
+        return Document();
+
     if( recordChanges[ collection_name ].count( id ) )
     {
         for( auto& kv : recordChanges[ collection_name ][ id ] )
@@ -353,6 +463,8 @@ DataBase::Document DataBase::Get( const string& collection_name, uint id )
 
 void DataBase::StartChanges()
 {
+    SCOPE_LOCK( changesLocker );
+
     RUNTIME_ASSERT( !changesStarted );
     RUNTIME_ASSERT( recordChanges.empty() );
     RUNTIME_ASSERT( newRecords.empty() );
@@ -363,6 +475,8 @@ void DataBase::StartChanges()
 
 void DataBase::Insert( const string& collection_name, uint id, const Document& doc )
 {
+    SCOPE_LOCK( changesLocker );
+
     RUNTIME_ASSERT( changesStarted );
     RUNTIME_ASSERT( !newRecords[ collection_name ].count( id ) );
     RUNTIME_ASSERT( !deletedRecords[ collection_name ].count( id ) );
@@ -374,6 +488,8 @@ void DataBase::Insert( const string& collection_name, uint id, const Document& d
 
 void DataBase::Update( const string& collection_name, uint id, const string& key, const Value& value )
 {
+    SCOPE_LOCK( changesLocker );
+
     RUNTIME_ASSERT( changesStarted );
     RUNTIME_ASSERT( !deletedRecords[ collection_name ].count( id ) );
 
@@ -382,6 +498,8 @@ void DataBase::Update( const string& collection_name, uint id, const string& key
 
 void DataBase::Delete( const string& collection_name, uint id )
 {
+    SCOPE_LOCK( changesLocker );
+
     RUNTIME_ASSERT( changesStarted );
     RUNTIME_ASSERT( !deletedRecords[ collection_name ].count( id ) );
 
@@ -392,30 +510,39 @@ void DataBase::Delete( const string& collection_name, uint id )
 
 void DataBase::CommitChanges()
 {
-    RUNTIME_ASSERT( changesStarted );
+    SCOPE_LOCK( backendLocker );
 
-    changesStarted = false;
+    // Take out changes, storage is written without changes lock
+    Collections  record_changes;
+    RecordsState new_records;
+    RecordsState deleted_records;
+    {
+        SCOPE_LOCK( changesLocker );
 
-    for( auto& collection : recordChanges )
+        RUNTIME_ASSERT( changesStarted );
+
+        changesStarted = false;
+        record_changes.swap( recordChanges );
+        new_records.swap( newRecords );
+        deleted_records.swap( deletedRecords );
+    }
+
+    for( auto& collection : record_changes )
     {
         for( auto& data : collection.second )
         {
-            auto it = newRecords.find( collection.first );
-            if( it != newRecords.end() && it->second.count( data.first ) )
+            auto it = new_records.find( collection.first );
+            if( it != new_records.end() && it->second.count( data.first ) )
                 InsertRecord( collection.first, data.first, data.second );
             else
                 UpdateRecord( collection.first, data.first, data.second );
         }
     }
 
-    for( auto& collection : deletedRecords )
+    for( auto& collection : deleted_records )
         for( auto & id : collection.second )
             DeleteRecord( collection.first, id );
 
-    recordChanges.clear();
-    newRecords.clear();
-    deletedRecords.clear();
-
     CommitRecords();
 }
 
@@ -433,7 +560,8 @@ public:
         return db_json;
     }
 
-    virtual UIntVec GetAllIds( const string& collection_name ) override
+protected:
+    virtual UIntVec GetAllRecordIds( const string& collection_name ) override
     {
         UIntVec ids;
         StrVec  paths;
@@ -449,11 +577,29 @@ public:
         return ids;
     }
 
-protected:
     virtual Document GetRecord( const string& collection_name, uint id ) override
     {
-        string path = FileManager::GetWritePath( _str( "{}/{}/{}.json", storageDir, collection_name, id ) );
-        void*  f = FileOpen( path.c_str(), false );
+        return ReadRecord( FileManager::GetWritePath( _str( "{}/{}/{}.json", storageDir, collection_name, id ) ) );
+    }
+
+    virtual void GetAllRecords( const string& collection_name, Collection& records ) override
+    {
+        UIntVec ids = GetAllRecordIds( collection_name );
+
+        // Read and parse files on worker threads
+        vector< Document > docs( ids.size() );
+        ParallelFor( ids.size(), [ this, &collection_name, &ids, &docs ] ( size_t i )
+                     {
+                         docs[ i ] = ReadRecord( FileManager::GetWritePath( _str( "{}/{}/{}.json", storageDir, collection_name, ids[ i ] ) ) );
+                     } );
+
+        for( size_t i = 0; i < ids.size(); i++ )
+            records.insert( std::make_pair( ids[ i ], std::move( docs[ i ] ) ) );
+    }
+
+    static Document ReadRecord( const string& path )
+    {
+        void* f = FileOpen( path.c_str(), false );
         if( !f )
             return Document();
 
@@ -604,7 +750,8 @@ public:
         collections.clear();
     }
 
-    virtual UIntVec GetAllIds( const string& collection_name ) override
+protected:
+    virtual UIntVec GetAllRecordIds( const string& collection_name ) override
     {
         unqlite* db = GetCollection( collection_name );
         RUNTIME_ASSERT( db );
@@ -639,7 +786,6 @@ public:
         return ids;
     }
 
-protected:
     virtual Document GetRecord( const string& collection_name, uint id ) override
     {
         unqlite* db = GetCollection( collection_name );
@@ -663,6 +809,67 @@ protected:
         return doc;
     }
 
+    virtual void GetAllRecords( const string& collection_name, Collection& records ) override
+    {
+        unqlite* db = GetCollection( collection_name );
+        RUNTIME_ASSERT( db );
+
+        unqlite_kv_cursor* cursor;
+        int                kv_cursor_init = unqlite_kv_cursor_init( db, &cursor );
+        RUNTIME_ASSERT( kv_cursor_init == UNQLITE_OK );
+
+        int kv_cursor_first_entry = unqlite_kv_cursor_first_entry( cursor );
+        RUNTIME_ASSERT( kv_cursor_first_entry == UNQLITE_OK || kv_cursor_first_entry == UNQLITE_DONE );
+
+        // Collect raw data in one pass
+        UIntVec            ids;
+        vector< UCharVec > raw_docs;
+        while( unqlite_kv_cursor_valid_entry( cursor ) )
+        {
+            uint id;
+            int  kv_cursor_key_callback = unqlite_kv_cursor_key_callback( cursor,
+                                                                          [] ( const void* output, unsigned int output_len, void* user_data )
+                                                                          {
+                                                                              RUNTIME_ASSERT( output_len == sizeof( uint ) );
+                                                                              *(uint*) user_data = *(uint*) output;
+                                                                              return UNQLITE_OK;
+                                                                          }, &id );
+            RUNTIME_ASSERT( kv_cursor_key_callback == UNQLITE_OK );
+            RUNTIME_ASSERT( id != 0 );
+
+            UCharVec raw_doc;
+            int      kv_cursor_data_callback = unqlite_kv_cursor_data_callback( cursor,
+                                                                                [] ( const void* output, unsigned int output_len, void* user_data )
+                                                                                {
+                                                                                    UCharVec& raw_doc = *(UCharVec*) user_data;
+                                                                                    raw_doc.insert( raw_doc.end(), (const uchar*) output, (const uchar*) output + output_len );
+                                                                                    return UNQLITE_OK;
+                                                                                }, &raw_doc );
+            RUNTIME_ASSERT( kv_cursor_data_callback == UNQLITE_OK );
+
+            ids.push_back( id );
+            raw_docs.push_back( std::move( raw_doc ) );
+
+            int kv_cursor_next_entry = unqlite_kv_cursor_next_entry( cursor );
+            RUNTIME_ASSERT( kv_cursor_next_entry == UNQLITE_OK || kv_cursor_next_entry == UNQLITE_DONE );
+        }
+
+        unqlite_kv_cursor_release( db, cursor );
+
+        // Parse on worker threads
+        vector< Document > docs( ids.size() );
+        ParallelFor( ids.size(), [ &raw_docs, &docs ] ( size_t i )
+                     {
+                         bson_t bson;
+                         bool init_static = bson_init_static( &bson, &raw_docs[ i ][ 0 ], raw_docs[ i ].size() );
+                         RUNTIME_ASSERT( init_static );
+                         BsonToDocument( &bson, docs[ i ] );
+                     } );
+
+        for( size_t i = 0; i < ids.size(); i++ )
+            records.insert( std::make_pair( ids[ i ], std::move( docs[ i ] ) ) );
+    }
+
     virtual void InsertRecord( const string& collection_name, uint id, const Document& doc ) override
     {
         RUNTIME_ASSERT( !doc.empty() );
@@ -823,7 +1030,8 @@ public:
         mongoc_cleanup();
     }
 
-    virtual UIntVec GetAllIds( const string& collection_name ) override
+protected:
+    virtual UIntVec GetAllRecordIds( const string& collection_name ) override
     {
         mongoc_collection_t* collection = GetCollection( collection_name );
         RUNTIME_ASSERT( collection );
@@ -864,7 +1072,6 @@ public:
         return ids;
     }
 
-protected:
     virtual Document GetRecord( const string& collection_name, uint id ) override
     {
         mongoc_collection_t* collection = GetCollection( collection_name );
@@ -895,6 +1102,53 @@ protected:
         return doc;
     }
 
+    virtual void GetAllRecords( const string& collection_name, Collection& records ) override
+    {
+        mongoc_collection_t* collection = GetCollection( collection_name );
+        RUNTIME_ASSERT( collection );
+
+        bson_t query;
+        bson_init( &query );
+
+        mongoc_cursor_t* cursor = mongoc_collection_find( collection, MONGOC_QUERY_NONE, 0, 0, uint( -1 ), &query, nullptr, nullptr );
+        RUNTIME_ASSERT( cursor );
+
+        // Fetch all documents in one query
+        UIntVec            ids;
+        vector< UCharVec > raw_docs;
+        const bson_t*      document;
+        while( mongoc_cursor_next( cursor, &document ) )
+        {
+            bson_iter_t iter;
+            bool        iter_find = bson_iter_init_find( &iter, document, "_id" );
+            RUNTIME_ASSERT( iter_find );
+            RUNTIME_ASSERT( bson_iter_type( &iter ) == BSON_TYPE_INT32 );
+
+            ids.push_back( bson_iter_int32( &iter ) );
+            const uint8_t* data = bson_get_data( document );
+            raw_docs.push_back( UCharVec( data, data + document->len ) );
+        }
+
+        bson_error_t error;
+        RUNTIME_ASSERT_STR( !mongoc_cursor_error( cursor, &error ), error.message );
+
+        mongoc_cursor_destroy( cursor );
+        bson_destroy( &query );
+
+        // Parse on worker threads
+        vector< Document > docs( ids.size() );
+        ParallelFor( ids.size(), [ &raw_docs, &docs ] ( size_t i )
+                     {
+                         bson_t bson;
+                         bool init_static = bson_init_static( &bson, &raw_docs[ i ][ 0 ], raw_docs[ i ].size() );
+                         RUNTIME_ASSERT( init_static );
+                         BsonToDocument( &bson, docs[ i ] );
+                     } );
+
+        for( size_t i = 0; i < ids.size(); i++ )
+            records.insert( std::make_pair( ids[ i ], std::move( docs[ i ] ) ) );
+    }
+
     virtual void InsertRecord( const string& collection_name, uint id, const Document& doc ) override
     {
         RUNTIME_ASSERT( !doc.empty() );
@@ -1007,7 +1261,8 @@ public:
         return new DbMemory();
     }
 
-    virtual UIntVec GetAllIds( const string& collection_name ) override
+protected:
+    virtual UIntVec GetAllRecordIds( const string& collection_name ) override
     {
         Collection& collection = collections[ collection_name ];
 
@@ -1019,7 +1274,6 @@ public:
         return ids;
     }
 
-protected:
     virtual Document GetRecord( const string& collection_name, uint id ) override
     {
         Collection& collection = collections[ collection_name ];
@@ -1028,6 +1282,11 @@ protected:
         return it != collection.end() ? it->second : Document();
     }
 
+    virtual void GetAllRecords( const string& collection_name, Collection& records ) override
+    {
+        records = collections[ collection_name ];
+    }
+
     virtual void InsertRecord( const string& collection_name, uint id, const Document& doc ) override
     {
         RUNTIME_ASSERT( !doc.empty() );
@@ -28,9 +28,15 @@ private:
     Collections  recordChanges;
     RecordsState newRecords;
     RecordsState deletedRecords;
+    #ifndef NO_THREADING
+    Mutex        changesLocker; // Not committed changes
+    Mutex        backendLocker; // Storage access, taken before changesLocker
+    #endif
 
 protected:
+    virtual UIntVec  GetAllRecordIds( const string& collection_name ) = 0;
     virtual Document GetRecord( const string& collection_name, uint id ) = 0;
+    virtual void     GetAllRecords( const string& collection_name, Collection& records );
     virtual void     InsertRecord( const string& collection_name, uint id, const Document& doc ) = 0;
     virtual void     UpdateRecord( const string& collection_name, uint id, const Document& doc ) = 0;
     virtual void     DeleteRecord( const string& collection_name, uint id ) = 0;
@@ -38,8 +44,9 @@ protected:
 
 public:
     virtual ~DataBase() = default;
-    virtual UIntVec GetAllIds( const string& collection_name ) = 0;
-    Document        Get( const string& collection_name, uint id );
+    UIntVec    GetAllIds( const string& collection_name );
+    Document   Get( const string& collection_name, uint id );
+    Collection GetAll( const string& collection_name );
 
     void StartChanges();
     void Insert( const string& collection_name, uint id, const Document& doc );
@@ -198,6 +198,8 @@ struct BindClass
 
     static void Map_GetLocation()                {}
     static void Map_SetScript()                  {}
+    static void Map_WakeUp()                     {}
+    static void Map_IsHibernated()               {}
     static void Map_AddItem()                    {}
     static void Map_GetItems()                   {}
     static void Map_GetItemsHex()                {}
@@ -306,6 +308,7 @@ struct BindClass
     static void Global_GetAllNpc()              {}
     static void Global_GetAllMaps()             {}
     static void Global_GetAllLocations()        {}
+    static void Global_IpcSend()                {}
     static void Global_LoadImage()              {}
     static void Global_GetImageColor()          {}
     static void Global_SetTime()                {}
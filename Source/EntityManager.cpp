@@ -193,6 +193,8 @@ bool EntityManager::LoadEntities()
 {
     WriteLog( "Load entities...\n" );
 
+    double load_tick = Timer::AccurateTick();
+
     EntityType query[] =
     {
         EntityType::Location,
@@ -230,11 +232,15 @@ bool EntityManager::LoadEntities()
         else if( type == EntityType::Custom )
             collection_name = custom_types[ custom_index ] + "s";
 
-        UIntVec ids = DbStorage->GetAllIds( collection_name );
-        for( uint id : ids )
+        // Documents read and parsed in bulk, construction in id order on this thread
+        double               read_tick = Timer::AccurateTick();
+        DataBase::Collection docs = DbStorage->GetAll( collection_name );
+        double               restore_tick = Timer::AccurateTick();
+        for( auto& kv : docs )
         {
-            DataBase::Document doc = DbStorage->Get( collection_name, id );
-            auto               proto_it = doc.find( "_Proto" );
+            uint                id = kv.first;
+            DataBase::Document& doc = kv.second;
+            auto                proto_it = doc.find( "_Proto" );
             RUNTIME_ASSERT( proto_it != doc.end() );
             RUNTIME_ASSERT( proto_it->second.which() == DataBase::StringValue );
 
@@ -286,17 +292,31 @@ bool EntityManager::LoadEntities()
                 RUNTIME_ASSERT( !"Unreachable place" );
             }
         }
+
+        WriteLog( "Loaded {} {}, read {} ms, restore {} ms.\n", docs.size(), collection_name,
+                  (uint) ( restore_tick - read_tick ), (uint) ( Timer::AccurateTick() - restore_tick ) );
     }
 
-    WriteLog( "Load entities complete.\n" );
+    WriteLog( "Load entities complete ({} ms).\n", (uint) ( Timer::AccurateTick() - load_tick ) );
 
+    double link_tick = Timer::AccurateTick();
     if( !LinkMaps() )
         return false;
+    WriteLog( "Link maps time {} ms.\n", (uint) ( Timer::AccurateTick() - link_tick ) );
+
+    link_tick = Timer::AccurateTick();
     if( !LinkNpc() )
         return false;
+    WriteLog( "Link npc time {} ms.\n", (uint) ( Timer::AccurateTick() - link_tick ) );
+
+    link_tick = Timer::AccurateTick();
     if( !LinkItems() )
         return false;
+    WriteLog( "Link items time {} ms.\n", (uint) ( Timer::AccurateTick() - link_tick ) );
+
+    link_tick = Timer::AccurateTick();
     InitAfterLoad();
+    WriteLog( "Init after load time {} ms.\n", (uint) ( Timer::AccurateTick() - link_tick ) );
     return true;
 }
 
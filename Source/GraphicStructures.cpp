@@ -79,60 +79,102 @@ void Texture::UpdateRegion( const Rect& r, const uchar* data )
 // TextureAtlas
 //
 
-TextureAtlas::SpaceNode::SpaceNode( int x, int y, int w, int h )
+TextureAtlas::TextureAtlas(): Type( 0 ), RT( nullptr ), TextureOwner( nullptr ), Width( 0 ), Height( 0 ), UsedArea( 0 ), FailW( 0 ), FailH( 0 )
 {
-    busy = false;
-    posX = x;
-    posY = y;
-    width = w;
-    height = h;
-    child1 = child2 = nullptr;
+    // Dummy comment
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    // Dummy comment
 }
 
-TextureAtlas::SpaceNode::~SpaceNode()
+void TextureAtlas::Init( uint w, uint h )
 {
-    SAFEDEL( child1 );
-    SAFEDEL( child2 );
+    Width = w;
+    Height = h;
+    UsedArea = 0;
+    FailW = FailH = 0;
+    Skyline.clear();
+    Skyline.push_back( SkylineNode( 0, 0, w ) );
 }
 
-bool TextureAtlas::SpaceNode::FindPosition( int w, int h, int& x, int& y )
+bool TextureAtlas::FindPosition( uint w, uint h, int& x, int& y )
 {
-    bool result = false;
-    if( child1 )
-        result = child1->FindPosition( w, h, x, y );
-    if( !result && child2 )
-        result = child2->FindPosition( w, h, x, y );
-    if( !result && !busy && width >= w && height >= h )
+    // Skip without search if not enough space at all or same or bigger size already not fit
+    if( w > Width || h > Height || Width * Height - UsedArea < w * h )
+        return false;
+    if( FailW && w >= FailW && h >= FailH )
+        return false;
+
+    // Lowest place on skyline, leftmost of equals
+    size_t best = Skyline.size();
+    uint   best_y = 0;
+    for( size_t i = 0; i < Skyline.size(); i++ )
     {
-        result = true;
-        busy = true;
-        x = posX;
-        y = posY;
-        if( width == w && height > h )
+        uint left = Skyline[ i ].X;
+        uint right = left + w;
+        if( right > Width )
+            break;
+
+        uint top = 0;
+        for( size_t j = i; j < Skyline.size() && Skyline[ j ].X < right; j++ )
+            top = MAX( top, Skyline[ j ].Y );
+        if( top + h <= Height && ( best == Skyline.size() || top < best_y ) )
         {
-            child1 = new SpaceNode( posX, posY + h, width, height - h );
+            best = i;
+            best_y = top;
         }
-        else if( height == h && width > w )
+    }
+
+    if( best == Skyline.size() )
+    {
+        if( !FailW || ( w <= FailW && h <= FailH ) )
         {
-            child1 = new SpaceNode( posX + w, posY, width - w, height );
+            FailW = w;
+            FailH = h;
         }
-        else if( width > w && height > h )
+        return false;
+    }
+
+    // Raise skyline under placed sprite
+    SkylineNode node( Skyline[ best ].X, best_y + h, w );
+    Skyline.insert( Skyline.begin() + best, node );
+    for( size_t i = best + 1; i < Skyline.size();)
+    {
+        SkylineNode& n = Skyline[ i ];
+        if( n.X >= node.X + node.W )
+            break;
+
+        if( n.X + n.W <= node.X + node.W )
         {
-            child1 = new SpaceNode( posX + w, posY, width - w, h );
-            child2 = new SpaceNode( posX, posY + h, width, height - h );
+            Skyline.erase( Skyline.begin() + i );
+            continue;
         }
+
+        n.W = n.X + n.W - ( node.X + node.W );
+        n.X = node.X + node.W;
+        break;
     }
-    return result;
-}
 
-TextureAtlas::TextureAtlas()
-{
-    memzero( this, sizeof( TextureAtlas ) );
-}
+    // Merge neighbors with same height
+    for( size_t i = 0; i + 1 < Skyline.size();)
+    {
+        if( Skyline[ i ].Y == Skyline[ i + 1 ].Y )
+        {
+            Skyline[ i ].W += Skyline[ i + 1 ].W;
+            Skyline.erase( Skyline.begin() + i + 1 );
+        }
+        else
+        {
+            i++;
+        }
+    }
 
-TextureAtlas::~TextureAtlas()
-{
-    SAFEDEL( RootNode );
+    UsedArea += w * h;
+    x = node.X;
+    y = best_y;
+    return true;
 }
 
 //
@@ -302,29 +302,25 @@ typedef vector< RenderTarget* > RenderTargetVec;
 
 struct TextureAtlas
 {
-    struct SpaceNode
+    struct SkylineNode
     {
-private:
-        bool       busy;
-        int        posX, posY;
-        int        width, height;
-        SpaceNode* child1, * child2;
-
-public:
-        SpaceNode( int x, int y, int w, int h );
-        ~SpaceNode();
-        bool FindPosition( int w, int h, int& x, int& y );
+        uint X, Y, W;
+        SkylineNode( uint x, uint y, uint w ): X( x ), Y( y ), W( w ) {}
     };
+    typedef vector< SkylineNode > SkylineNodeVec;
 
-    int           Type;
-    RenderTarget* RT;
-    Texture*      TextureOwner;
-    uint          Width, Height;
-    SpaceNode*    RootNode;                               // Packer 1
-    uint          CurX, CurY, LineMaxH, LineCurH, LineW;  // Packer 2
+    int            Type;
+    RenderTarget*  RT;
+    Texture*       TextureOwner;
+    uint           Width, Height;
+    SkylineNodeVec Skyline;      // Top edge of used space, from left to right
+    uint           UsedArea;
+    uint           FailW, FailH; // Smallest size that not fit, bigger ones skipped
 
     TextureAtlas();
     ~TextureAtlas();
+    void Init( uint w, uint h );
+    bool FindPosition( uint w, uint h, int& x, int& y );
 };
 typedef vector< TextureAtlas* > TextureAtlasVec;
 
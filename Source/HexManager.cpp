@@ -253,6 +253,9 @@ HexManager::HexManager()
     hexField = nullptr;
     hexTrack = nullptr;
     hexLight = nullptr;
+    lightBlocks = nullptr;
+    lightCacheCur = nullptr;
+    lightCacheGeneration = 0;
     hTop = 0;
     hBottom = 0;
     wLeft = 0;
@@ -1460,13 +1463,18 @@ void HexManager::PrepareLightToDraw()
 #define MAX_LIGHT_ALPHA      ( 255 )
 #define LIGHT_SOFT_LENGTH    ( HEX_W )
 
-void HexManager::MarkLight( ushort hx, ushort hy, uint inten )
+void HexManager::ApplyLightMark( const LightMark& mark )
 {
-    int    light = inten * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
-    int    lr = light * lightProcentR / 100;
-    int    lg = light * lightProcentG / 100;
-    int    lb = light * lightProcentB / 100;
-    uchar* p = &hexLight[ hy * maxHexX * 3 + hx * 3 ];
+    uchar* p = &hexLight[ mark.Index ];
+    int    lr = mark.R;
+    int    lg = mark.G;
+    int    lb = mark.B;
+    if( mark.Neighbor )
+    {
+        lr = MIN( int(*p) + lr, mark.FullR );
+        lg = MIN( int( *( p + 1 ) ) + lg, mark.FullG );
+        lb = MIN( int( *( p + 2 ) ) + lb, mark.FullB );
+    }
     if( lr > *p )
         *p = lr;
     if( lg > *( p + 1 ) )
@@ -1475,6 +1483,21 @@ void HexManager::MarkLight( ushort hx, ushort hy, uint inten )
         *( p + 2 ) = lb;
 }
 
+void HexManager::MarkLight( ushort hx, ushort hy, uint inten )
+{
+    int       light = inten * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
+    LightMark mark;
+    mark.Index = hy * maxHexX * 3 + hx * 3;
+    mark.Neighbor = false;
+    mark.R = light * lightProcentR / 100;
+    mark.G = light * lightProcentG / 100;
+    mark.B = light * lightProcentB / 100;
+    mark.FullR = mark.FullG = mark.FullB = 0;
+    if( lightCacheCur )
+        lightCacheCur->Marks.push_back( mark );
+    ApplyLightMark( mark );
+}
+
 void HexManager::MarkLightEndNeighbor( ushort hx, ushort hy, bool north_south, uint inten )
 {
     Field& f = GetField( hx, hy );
@@ -1485,27 +1508,20 @@ void HexManager::MarkLightEndNeighbor( ushort hx, ushort hy, bool north_south, u
             ( !north_south && ( lt == CORNER_EAST_WEST || lt == CORNER_EAST ) ) ||
             lt == CORNER_SOUTH )
         {
-            uchar* p = &hexLight[ hy * maxHexX * 3 + hx * 3 ];
-            int    light_full = inten * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
-            int    light_self = ( inten / 2 ) * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
-            int    lr_full = light_full * lightProcentR / 100;
-            int    lg_full = light_full * lightProcentG / 100;
-            int    lb_full = light_full * lightProcentB / 100;
-            int    lr_self = int(*p) + light_self * lightProcentR / 100;
-            int    lg_self = int( *( p + 1 ) ) + light_self * lightProcentG / 100;
-            int    lb_self = int( *( p + 2 ) ) + light_self * lightProcentB / 100;
-            if( lr_self > lr_full )
-                lr_self = lr_full;
-            if( lg_self > lg_full )
-                lg_self = lg_full;
-            if( lb_self > lb_full )
-                lb_self = lb_full;
-            if( lr_self > *p )
-                *p = lr_self;
-            if( lg_self > *( p + 1 ) )
-                *( p + 1 ) = lg_self;
-            if( lb_self > *( p + 2 ) )
-                *( p + 2 ) = lb_self;
+            int       light_full = inten * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
+            int       light_self = ( inten / 2 ) * MAX_LIGHT_HEX / MAX_LIGHT_VALUE * lightCapacity / 100;
+            LightMark mark;
+            mark.Index = hy * maxHexX * 3 + hx * 3;
+            mark.Neighbor = true;
+            mark.R = light_self * lightProcentR / 100;
+            mark.G = light_self * lightProcentG / 100;
+            mark.B = light_self * lightProcentB / 100;
+            mark.FullR = light_full * lightProcentR / 100;
+            mark.FullG = light_full * lightProcentG / 100;
+            mark.FullB = light_full * lightProcentB / 100;
+            if( lightCacheCur )
+                lightCacheCur->Marks.push_back( mark );
+            ApplyLightMark( mark );
         }
     }
 }
@@ -1717,8 +1733,6 @@ void HexManager::ParseLightTriangleFan( LightSource& ls )
     lightProcentG = ( ( color >> 8 ) & 0xFF ) * 100 / 0xFF;
     lightProcentB = ( color & 0xFF ) * 100 / 0xFF;
 
-    // Begin
-    MarkLight( hx, hy, inten );
     int base_x, base_y;
     GetHexCurrentPosition( hx, hy, base_x, base_y );
     base_x += HEX_OX;
@@ -1729,6 +1743,47 @@ void HexManager::ParseLightTriangleFan( LightSource& ls )
         lightPoints.push_back( PointVec() );
     PointVec& points = lightPoints[ lightPointsCount - 1 ];
     points.clear();
+
+    // Hex marks are recorded only in view, so visible part of light reach must be same for reuse
+    int reach = dist + 1;
+    int min_hx = MAX( (int) hx - reach, lightMinHx );
+    int max_hx = MIN( (int) hx + reach, lightMaxHx );
+    int min_hy = MAX( (int) hy - reach, lightMinHy );
+    int max_hy = MIN( (int) hy + reach, lightMaxHy );
+
+    // Already traced, points stored relative to light center
+    uint hex_index = hy * maxHexX + hx;
+    for( auto it = lightCache.lower_bound( hex_index ), end = lightCache.upper_bound( hex_index ); it != end; ++it )
+    {
+        LightCache* cache = it->second;
+        if( cache->Source.ColorRGB != ls.ColorRGB || cache->Source.Distance != ls.Distance || cache->Source.Flags != ls.Flags ||
+            cache->Source.Intensity != ls.Intensity || cache->Source.OffsX != ls.OffsX || cache->Capacity != lightCapacity )
+            continue;
+        if( cache->MinHx != min_hx || cache->MaxHx != max_hx || cache->MinHy != min_hy || cache->MaxHy != max_hy )
+            continue;
+
+        cache->Generation = lightCacheGeneration;
+        for( auto& mark : cache->Marks )
+            ApplyLightMark( mark );
+        points.reserve( cache->Points.size() );
+        for( auto& p : cache->Points )
+            points.push_back( PrepPoint( base_x + p.PointX, base_y + p.PointY, p.PointColor, p.PointOffsX, p.PointOffsY ) );
+        for( auto& p : cache->SoftPoints )
+            lightSoftPoints.push_back( PrepPoint( base_x + p.PointX, base_y + p.PointY, p.PointColor, p.PointOffsX, p.PointOffsY ) );
+        return;
+    }
+
+    lightCacheCur = new LightCache( ls, lightCapacity );
+    lightCacheCur->MinHx = min_hx;
+    lightCacheCur->MaxHx = max_hx;
+    lightCacheCur->MinHy = min_hy;
+    lightCacheCur->MaxHy = max_hy;
+    lightCacheCur->Generation = lightCacheGeneration;
+    lightCache.insert( std::make_pair( hex_index, lightCacheCur ) );
+    size_t soft_points_begin = lightSoftPoints.size();
+
+    // Begin
+    MarkLight( hx, hy, inten );
     points.reserve( 3 + dist * DIRS_COUNT );
     points.push_back( PrepPoint( base_x, base_y, color, ls.OffsX, ls.OffsY ) ); // Center of light
 
@@ -1811,6 +1866,17 @@ void HexManager::ParseLightTriangleFan( LightSource& ls )
                 lightSoftPoints.push_back( PrepPoint( next.PointX + int(x), next.PointY + int(y), next.PointColor, next.PointOffsX, next.PointOffsY ) );
         }
     }
+
+    // Remember traced light
+    lightCacheCur->Points.reserve( points.size() );
+    for( auto& p : points )
+        lightCacheCur->Points.push_back( PrepPoint( p.PointX - base_x, p.PointY - base_y, p.PointColor, p.PointOffsX, p.PointOffsY ) );
+    for( size_t i = soft_points_begin; i < lightSoftPoints.size(); i++ )
+    {
+        PrepPoint& p = lightSoftPoints[ i ];
+        lightCacheCur->SoftPoints.push_back( PrepPoint( p.PointX - base_x, p.PointY - base_y, p.PointColor, p.PointOffsX, p.PointOffsY ) );
+    }
+    lightCacheCur = nullptr;
 }
 
 void HexManager::RealRebuildLight()
@@ -1822,20 +1888,122 @@ void HexManager::RealRebuildLight()
     ClearHexLight();
     CollectLightSources();
 
-    lightMinHx = viewField[ 0 ].HexX;
-    lightMaxHx = viewField[ hVisible * wVisible - 1 ].HexX;
-    lightMinHy = viewField[ wVisible - 1 ].HexY;
-    lightMaxHy = viewField[ hVisible * wVisible - wVisible ].HexY;
+    // View field bounds, take all corners because of hexagonal projection
+    ViewField* corners[ 4 ] = { &viewField[ 0 ], &viewField[ wVisible - 1 ],
+                                &viewField[ hVisible * wVisible - wVisible ], &viewField[ hVisible * wVisible - 1 ] };
+    lightMinHx = lightMaxHx = corners[ 0 ]->HexX;
+    lightMinHy = lightMaxHy = corners[ 0 ]->HexY;
+    for( int i = 1; i < 4; i++ )
+    {
+        lightMinHx = MIN( lightMinHx, corners[ i ]->HexX );
+        lightMaxHx = MAX( lightMaxHx, corners[ i ]->HexX );
+        lightMinHy = MIN( lightMinHy, corners[ i ]->HexY );
+        lightMaxHy = MAX( lightMaxHy, corners[ i ]->HexY );
+    }
+
+    CheckLightBlocks();
 
+    lightCacheGeneration++;
     for( auto it = lightSources.begin(), end = lightSources.end(); it != end; ++it )
     {
         LightSource& ls = *it;
-        #pragma MESSAGE( "Optimize lighting rebuilding to skip unvisible lights." )
-        // if( (int) ls.HexX < lightMinHx - (int) ls.Distance || (int) ls.HexX > lightMaxHx + (int) ls.Distance ||
-        //    (int) ls.HexY < lightMinHy - (int) ls.Distance || (int) ls.HexY > lightMaxHy + (int) ls.Distance )
-        //    continue;
+
+        // Skip lights not reached view
+        int dist = ls.Distance + 1;
+        if( (int) ls.HexX < lightMinHx - dist || (int) ls.HexX > lightMaxHx + dist ||
+            (int) ls.HexY < lightMinHy - dist || (int) ls.HexY > lightMaxHy + dist )
+            continue;
+
         ParseLightTriangleFan( ls );
     }
+
+    // Forget lights gone from view
+    for( auto it = lightCache.begin(); it != lightCache.end();)
+    {
+        if( it->second->Generation != lightCacheGeneration )
+        {
+            delete it->second;
+            it = lightCache.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void HexManager::CheckLightBlocks()
+{
+    if( !IsMapLoaded() )
+        return;
+
+    // Only lights reached view are traced, their hexes lie within two max reaches from view,
+    // hexes outside are compared later when come closer
+    int reach = 0;
+    for( auto& ls : lightSources )
+        reach = MAX( reach, (int) ls.Distance + 1 );
+    int min_hx = MAX( lightMinHx - reach * 2, 0 );
+    int max_hx = MIN( lightMaxHx + reach * 2, maxHexX - 1 );
+    int min_hy = MAX( lightMinHy - reach * 2, 0 );
+    int max_hy = MIN( lightMaxHy + reach * 2, maxHexY - 1 );
+
+    // Find hexes changed light passing since last rebuild
+    vector< pair< ushort, ushort > > changed;
+    for( int hy = min_hy; hy <= max_hy; hy++ )
+    {
+        for( int hx = min_hx; hx <= max_hx; hx++ )
+        {
+            Field& f = GetField( hx, hy );
+            uchar  blocks = ( f.Flags.IsWall ? 1 : 0 ) | ( f.Flags.IsWallTransp ? 2 : 0 ) | ( f.Flags.IsNoLight ? 4 : 0 ) | ( f.Corner << 3 );
+            uchar& last_blocks = lightBlocks[ hy * maxHexX + hx ];
+            if( blocks != last_blocks )
+            {
+                last_blocks = blocks;
+                changed.push_back( std::make_pair( hx, hy ) );
+            }
+        }
+    }
+    if( changed.empty() )
+        return;
+
+    // Retrace lights around changed hexes
+    if( changed.size() > 100 )
+    {
+        ClearLightCache();
+        return;
+    }
+
+    for( auto it = lightCache.begin(); it != lightCache.end();)
+    {
+        LightSource& ls = it->second->Source;
+        int          dist = ls.Distance + 1;
+        bool         affected = false;
+        for( auto& hex : changed )
+        {
+            if( abs( (int) hex.first - (int) ls.HexX ) <= dist && abs( (int) hex.second - (int) ls.HexY ) <= dist )
+            {
+                affected = true;
+                break;
+            }
+        }
+
+        if( affected )
+        {
+            delete it->second;
+            it = lightCache.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void HexManager::ClearLightCache()
+{
+    for( auto& kv : lightCache )
+        delete kv.second;
+    lightCache.clear();
 }
 
 void HexManager::CollectLightSources()
@@ -2118,6 +2286,8 @@ void HexManager::ResizeField( ushort w, ushort h )
     SAFEDELA( hexField );
     SAFEDELA( hexTrack );
     SAFEDELA( hexLight );
+    SAFEDELA( lightBlocks );
+    ClearLightCache();
     if( !w || !h )
         return;
 
@@ -2127,6 +2297,8 @@ void HexManager::ResizeField( ushort w, ushort h )
     memzero( hexTrack, w * h * sizeof( char ) );
     hexLight = new uchar[ w * h * 3 ];
     memzero( hexLight, w * h * 3 * sizeof( uchar ) );
+    lightBlocks = new uchar[ w * h ];
+    memzero( lightBlocks, w * h * sizeof( uchar ) );
 
     GameOpt.ClientMap = hexField;
     GameOpt.ClientMapLight = hexLight;
@@ -3049,15 +3221,21 @@ bool HexManager::GetHexPixel( int x, int y, ushort& hx, ushort& hy )
     float yf = (float) y - (float) GameOpt.ScrOy / GameOpt.SpritesZoom;
     float ox = (float) HEX_W / GameOpt.SpritesZoom;
     float oy = (float) HEX_REAL_H / GameOpt.SpritesZoom;
-    int   y2 = 0;
-    int   vpos = 0;
-
-    for( int ty = 0; ty < hVisible; ty++ )
-    {
-        for( int tx = 0; tx < wVisible; tx++ )
+    float line_h = (float) HEX_LINE_H / GameOpt.SpritesZoom;
+
+    // View field is regular grid, each row lower by line height and each next cell in row left by hex width
+    // Rows overlap when hex real height bigger than line height, so check few candidate rows from top
+    // Neighbor cells also checked to be not dependent on float rounding on borders
+    float y0 = viewField[ 0 ].ScrYf / GameOpt.SpritesZoom;
+    int   ty_from = MAX( (int) floorf( ( yf - y0 - oy ) / line_h ), 0 );
+    int   ty_to = MIN( (int) floorf( ( yf - y0 ) / line_h ) + 1, hVisible - 1 );
+    for( int ty = ty_from; ty <= ty_to; ty++ )
+    {
+        float x0 = viewField[ ty * wVisible ].ScrXf / GameOpt.SpritesZoom;
+        int   tx_center = (int) ceilf( ( x0 - xf ) / ox );
+        for( int tx = MAX( tx_center - 1, 0 ), tx_to = MIN( tx_center + 1, wVisible - 1 ); tx <= tx_to; tx++ )
         {
-            vpos = y2 + tx;
-
+            int   vpos = ty * wVisible + tx;
             float x_ = viewField[ vpos ].ScrXf / GameOpt.SpritesZoom;
             float y_ = viewField[ vpos ].ScrYf / GameOpt.SpritesZoom;
 
@@ -3088,7 +3266,6 @@ bool HexManager::GetHexPixel( int x, int y, ushort& hx, ushort& hy )
                 }
             }
         }
-        y2 += wVisible;
     }
 
     return false;
@@ -60,6 +60,31 @@ struct LightSource
 };
 typedef vector< LightSource > LightSourceVec;
 
+// Single hex lighting by source, neighbor marks add to already accumulated light
+struct LightMark
+{
+    uint Index;
+    bool Neighbor;
+    int  R, G, B;
+    int  FullR, FullG, FullB;
+};
+typedef vector< LightMark > LightMarkVec;
+
+// Traced light, reused until source, light blocking hexes around or visible part of its reach changed
+struct LightCache
+{
+    LightSource  Source;
+    int          Capacity;
+    int          MinHx, MaxHx, MinHy, MaxHy; // Marks recorded only within this rect
+    PointVec     Points;
+    PointVec     SoftPoints;
+    LightMarkVec Marks;
+    uint         Generation;
+
+    LightCache( const LightSource& ls, int capacity ): Source( ls ), Capacity( capacity ), MinHx( 0 ), MaxHx( 0 ), MinHy( 0 ), MaxHy( 0 ), Generation( 0 ) {}
+};
+typedef multimap< uint, LightCache* > LightCacheMap;
+
 /************************************************************************/
 /* Field                                                                */
 /************************************************************************/
@@ -331,7 +356,14 @@ private:
     int lightProcentG;
     int lightProcentB;
 
+    // Traced lights
+    LightCacheMap lightCache;
+    LightCache*   lightCacheCur;
+    uint          lightCacheGeneration;
+    uchar*        lightBlocks;
+
     void PrepareLightToDraw();
+    void ApplyLightMark( const LightMark& mark );
     void MarkLight( ushort hx, ushort hy, uint inten );
     void MarkLightEndNeighbor( ushort hx, ushort hy, bool north_south, uint inten );
     void MarkLightEnd( ushort from_hx, ushort from_hy, ushort to_hx, ushort to_hy, uint inten );
@@ -340,6 +372,8 @@ private:
     void ParseLightTriangleFan( LightSource& ls );
     void RealRebuildLight();
     void CollectLightSources();
+    void CheckLightBlocks();
+    void ClearLightCache();
 
 public:
     void            ClearHexLight()                     { memzero( hexLight, maxHexX * maxHexY * sizeof( uchar ) * 3 ); }
@@ -581,24 +581,37 @@ void ItemManager::RadioClear()
 {
     SCOPE_LOCK( radioItemsLocker );
 
-    radioItems.clear();
+    radioChannels.clear();
+    radioKeys.clear();
 }
 
 void ItemManager::RadioRegister( Item* radio, bool add )
 {
     SCOPE_LOCK( radioItemsLocker );
 
-    auto it = std::find( radioItems.begin(), radioItems.end(), radio );
-
-    if( add )
+    // Remove from previous channel and scope
+    auto it = radioKeys.find( radio );
+    if( it != radioKeys.end() )
     {
-        if( it == radioItems.end() )
-            radioItems.push_back( radio );
+        auto           it_channel = radioChannels.find( it->second.first );
+        RadioScopeMap& scopes = it_channel->second;
+        auto           it_scope = scopes.find( it->second.second );
+        ItemVec&       radios = it_scope->second;
+        radios.erase( std::find( radios.begin(), radios.end(), radio ) );
+        if( radios.empty() )
+            scopes.erase( it_scope );
+        if( scopes.empty() )
+            radioChannels.erase( it_channel );
+        radioKeys.erase( it );
     }
-    else
+
+    // Index only listeners, senders not needed here
+    if( add && radio->RadioIsRecvActive() )
     {
-        if( it != radioItems.end() )
-            radioItems.erase( it );
+        ushort channel = radio->GetRadioChannel();
+        uchar  scope = radio->GetRadioBroadcastRecv();
+        radioChannels[ channel ][ scope ].push_back( radio );
+        radioKeys.insert( std::make_pair( radio, std::make_pair( channel, scope ) ) );
     }
 }
 
@@ -640,52 +653,59 @@ void ItemManager::RadioSendTextEx( ushort channel, int broadcast_type, uint from
     uint broadcast_map_id = 0;
     uint broadcast_loc_id = 0;
 
-    // Get copy of all radios
+    // Get copy of channel listeners
+    RadioScopeMap scopes;
     radioItemsLocker.Lock();
-    ItemVec radio_items = radioItems;
+    auto it_channel = radioChannels.find( channel );
+    if( it_channel != radioChannels.end() )
+        scopes = it_channel->second;
     radioItemsLocker.Unlock();
+    if( scopes.empty() )
+        return;
 
     // Multiple sending controlling
     // Not thread safe, but this not so important in this case
     static uint msg_count = 0;
     msg_count++;
 
-    // Send
-    for( auto it = radio_items.begin(), end = radio_items.end(); it != end; ++it )
+    // Send, broadcast resolved once per receive scope
+    for( auto it = scopes.begin(), end = scopes.end(); it != end; ++it )
     {
-        Item* radio = *it;
-
-        if( radio->GetRadioChannel() == channel && radio->RadioIsRecvActive() )
+        int recv_broadcast = it->first;
+        if( broadcast_type != RADIO_BROADCAST_FORCE_ALL && recv_broadcast != RADIO_BROADCAST_FORCE_ALL )
         {
-            if( broadcast_type != RADIO_BROADCAST_FORCE_ALL && radio->GetRadioBroadcastRecv() != RADIO_BROADCAST_FORCE_ALL )
+            if( broadcast_type == RADIO_BROADCAST_WORLD )
+                broadcast = recv_broadcast;
+            else if( recv_broadcast == RADIO_BROADCAST_WORLD )
+                broadcast = broadcast_type;
+            else
+                broadcast = MIN( broadcast_type, recv_broadcast );
+
+            if( broadcast == RADIO_BROADCAST_WORLD )
+                broadcast = RADIO_BROADCAST_FORCE_ALL;
+            else if( broadcast == RADIO_BROADCAST_MAP || broadcast == RADIO_BROADCAST_LOCATION )
             {
-                if( broadcast_type == RADIO_BROADCAST_WORLD )
-                    broadcast = radio->GetRadioBroadcastRecv();
-                else if( radio->GetRadioBroadcastRecv() == RADIO_BROADCAST_WORLD )
-                    broadcast = broadcast_type;
-                else
-                    broadcast = MIN( broadcast_type, radio->GetRadioBroadcastRecv() );
-
-                if( broadcast == RADIO_BROADCAST_WORLD )
-                    broadcast = RADIO_BROADCAST_FORCE_ALL;
-                else if( broadcast == RADIO_BROADCAST_MAP || broadcast == RADIO_BROADCAST_LOCATION )
+                if( !broadcast_map_id )
                 {
-                    if( !broadcast_map_id )
-                    {
-                        Map* map = MapMngr.GetMap( from_map_id );
-                        if( !map )
-                            continue;
-                        broadcast_map_id = map->GetId();
-                        broadcast_loc_id = map->GetLocation()->GetId();
-                    }
+                    Map* map = MapMngr.GetMap( from_map_id );
+                    if( !map )
+                        continue;
+                    broadcast_map_id = map->GetId();
+                    broadcast_loc_id = map->GetLocation()->GetId();
                 }
-                else if( !( broadcast >= 101 && broadcast <= 200 ) /*RADIO_BROADCAST_ZONE*/ )
-                    continue;
-            }
-            else
-            {
-                broadcast = RADIO_BROADCAST_FORCE_ALL;
             }
+            else if( !( broadcast >= 101 && broadcast <= 200 ) /*RADIO_BROADCAST_ZONE*/ )
+                continue;
+        }
+        else
+        {
+            broadcast = RADIO_BROADCAST_FORCE_ALL;
+        }
+
+        ItemVec& radios = it->second;
+        for( auto it_radio = radios.begin(), end_radio = radios.end(); it_radio != end_radio; ++it_radio )
+        {
+            Item* radio = *it_radio;
 
             if( radio->GetAccessory() == ITEM_ACCESSORY_CRITTER )
             {
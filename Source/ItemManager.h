@@ -40,8 +40,13 @@ public:
 
     // Radio
 private:
-    ItemVec radioItems;
-    Mutex   radioItemsLocker;
+    // Receive-active radios by channel, grouped by receive broadcast scope
+    typedef map< uchar, ItemVec >               RadioScopeMap;
+    typedef map< ushort, RadioScopeMap >        RadioChannelMap;
+    typedef map< Item*, pair< ushort, uchar > > RadioKeyMap;
+    RadioChannelMap radioChannels;
+    RadioKeyMap     radioKeys;
+    Mutex           radioItemsLocker;
 
 public:
     void RadioClear();
@@ -481,7 +481,7 @@ static void UpdateInfo()
     Label::Update( GuiLabelUptime, _str( "Uptime: {:02}:{:02}:{:02}", seconds / 60 / 60, seconds / 60 % 60, seconds % 60 ) );
     Label::Update( GuiLabelSend, _str( "KBytes Send: {}", Server.Statistics.BytesSend / 1024 ) );
     Label::Update( GuiLabelRecv, _str( "KBytes Recv: {}", Server.Statistics.BytesRecv / 1024 ) );
-    Label::Update( GuiLabelCompress, _str( "Compress ratio: {}", (double) Server.Statistics.DataReal / ( Server.Statistics.DataCompressed ? Server.Statistics.DataCompressed : 1 ) ) );
+    Label::Update( GuiLabelCompress, _str( "Compress ratio: {}", Server.Statistics.CompressRatio ) );
 
     if( FOServer::UpdateIndex == -1 && FOServer::UpdateLastTick && FOServer::UpdateLastTick + 1000 < Timer::FastTick() )
     {
@@ -5,6 +5,167 @@
 #include "ItemManager.h"
 #include "MapManager.h"
 
+/************************************************************************/
+/* HexItemIndex                                                         */
+/************************************************************************/
+
+// Fibonacci hashing, capacity is power of two, take high bits of product
+// because low bits depend only on low bits of key (hex x)
+#define HEX_INDEX_HASH( key, shift )    ( ( ( key ) * 2654435769U ) >> ( shift ) )
+
+HexItemIndex::HexItemIndex()
+{
+    freeNode = None;
+    usedBuckets = 0;
+    hashShift = 32;
+}
+
+uint HexItemIndex::FindBucket( uint key )
+{
+    if( buckets.empty() )
+        return None;
+
+    uint mask = (uint) buckets.size() - 1;
+    for( uint i = HEX_INDEX_HASH( key, hashShift ); ; i = ( i + 1 ) & mask )
+    {
+        if( buckets[ i ].Key == key )
+            return i;
+        if( !buckets[ i ].Key )
+            return None;
+    }
+}
+
+void HexItemIndex::Rehash( uint capacity )
+{
+    vector< Bucket > old_buckets;
+    old_buckets.swap( buckets );
+    buckets.resize( capacity );
+    memzero( &buckets[ 0 ], capacity * sizeof( Bucket ) );
+
+    uint mask = capacity - 1;
+    hashShift = 32;
+    for( uint c = capacity; c > 1; c >>= 1 )
+        hashShift--;
+    for( const Bucket& bucket : old_buckets )
+    {
+        if( !bucket.Key )
+            continue;
+
+        uint i = HEX_INDEX_HASH( bucket.Key, hashShift );
+        while( buckets[ i ].Key )
+            i = ( i + 1 ) & mask;
+        buckets[ i ] = bucket;
+    }
+}
+
+void HexItemIndex::Add( ushort hx, ushort hy, Item* item )
+{
+    uint node;
+    if( freeNode != None )
+    {
+        node = freeNode;
+        freeNode = nodes[ node ].Next;
+    }
+    else
+    {
+        node = (uint) nodes.size();
+        nodes.push_back( Node() );
+    }
+    nodes[ node ].Value = item;
+    nodes[ node ].Next = None;
+
+    uint key = MakeKey( hx, hy );
+    uint bucket = FindBucket( key );
+    if( bucket != None )
+    {
+        // Keep insertion order
+        uint last = buckets[ bucket ].Head;
+        while( nodes[ last ].Next != None )
+            last = nodes[ last ].Next;
+        nodes[ last ].Next = node;
+        return;
+    }
+
+    // Keep load factor under half
+    if( ( usedBuckets + 1 ) * 2 > (uint) buckets.size() )
+        Rehash( buckets.empty() ? 16 : (uint) buckets.size() * 2 );
+
+    uint mask = (uint) buckets.size() - 1;
+    uint i = HEX_INDEX_HASH( key, hashShift );
+    while( buckets[ i ].Key )
+        i = ( i + 1 ) & mask;
+    buckets[ i ].Key = key;
+    buckets[ i ].Head = node;
+    usedBuckets++;
+}
+
+void HexItemIndex::Remove( ushort hx, ushort hy, Item* item )
+{
+    uint bucket = FindBucket( MakeKey( hx, hy ) );
+    RUNTIME_ASSERT( bucket != None );
+
+    uint prev = None;
+    uint node = buckets[ bucket ].Head;
+    while( node != None && nodes[ node ].Value != item )
+    {
+        prev = node;
+        node = nodes[ node ].Next;
+    }
+    RUNTIME_ASSERT( node != None );
+
+    if( prev != None )
+        nodes[ prev ].Next = nodes[ node ].Next;
+    else
+        buckets[ bucket ].Head = nodes[ node ].Next;
+    nodes[ node ].Value = nullptr;
+    nodes[ node ].Next = freeNode;
+    freeNode = node;
+
+    if( buckets[ bucket ].Head != None )
+        return;
+
+    // Last item on hex, free bucket with backward shift to keep probe chains without tombstones
+    uint mask = (uint) buckets.size() - 1;
+    uint i = bucket;
+    uint j = bucket;
+    buckets[ i ].Key = 0;
+    while( true )
+    {
+        j = ( j + 1 ) & mask;
+        if( !buckets[ j ].Key )
+            break;
+
+        uint k = HEX_INDEX_HASH( buckets[ j ].Key, hashShift );
+        if( i <= j ? ( i < k && k <= j ) : ( i < k || k <= j ) )
+            continue;
+
+        buckets[ i ] = buckets[ j ];
+        buckets[ j ].Key = 0;
+        i = j;
+    }
+    usedBuckets--;
+
+    // Release pool after map cleared
+    if( !usedBuckets )
+    {
+        buckets.clear();
+        nodes.clear();
+        freeNode = None;
+    }
+}
+
+bool HexItemIndex::IsHexEmpty( ushort hx, ushort hy )
+{
+    return FindBucket( MakeKey( hx, hy ) ) == None;
+}
+
+HexItemIndex::Range HexItemIndex::Get( ushort hx, ushort hy )
+{
+    uint bucket = FindBucket( MakeKey( hx, hy ) );
+    uint head = ( bucket != None ? buckets[ bucket ].Head : None );
+    return Range { Iterator( this, head ), Iterator( this, None ) };
+}
+
 /************************************************************************/
 /* Map                                                                  */
 /************************************************************************/
@@ -40,6 +201,8 @@ Map::Map( uint id, ProtoMap* proto, Location* location ): Entity( id, EntityType
 
     hexFlags = nullptr;
     memzero( loopLastTick, sizeof( loopLastTick ) );
+    lastActiveTick = Timer::GameTick();
+    isHibernated = false;
 
     hexFlagsSize = GetWidth() * GetHeight();
     hexFlags = new uchar[ hexFlagsSize ];
@@ -72,8 +235,8 @@ void Map::DeleteContent()
             ItemMngr.DeleteItem( del_item );
     }
     RUNTIME_ASSERT( mapItemsById.empty() );
-    RUNTIME_ASSERT( mapItemsByHex.empty() );
-    RUNTIME_ASSERT( mapBlockLinesByHex.empty() );
+    RUNTIME_ASSERT( mapItemsByHex.IsEmpty() );
+    RUNTIME_ASSERT( mapBlockLinesByHex.IsEmpty() );
 }
 
 bool Map::Generate()
@@ -188,6 +351,13 @@ bool Map::Generate()
 void Map::Process()
 {
     uint tick = Timer::GameTick();
+
+    // Map without players for long time suspends npc moving and idle processing,
+    // loops and critter time events keep firing
+    if( !mapPlayers.empty() )
+        lastActiveTick = tick;
+    isHibernated = ( GameOpt.MapHibernationTime && tick - lastActiveTick >= GameOpt.MapHibernationTime );
+
     ProcessLoop( 0, GetLoopTime1(), tick );
     ProcessLoop( 1, GetLoopTime2(), tick );
     ProcessLoop( 2, GetLoopTime3(), tick );
@@ -195,6 +365,12 @@ void Map::Process()
     ProcessLoop( 4, GetLoopTime5(), tick );
 }
 
+void Map::WakeUp()
+{
+    lastActiveTick = Timer::GameTick();
+    isHibernated = false;
+}
+
 void Map::ProcessLoop( int index, uint time, uint tick )
 {
     if( time && tick - loopLastTick[ index ] >= time )
@@ -258,7 +434,10 @@ void Map::AddCritter( Critter* cr )
     RUNTIME_ASSERT( std::find( mapCritters.begin(), mapCritters.end(), cr ) == mapCritters.end() );
 
     if( cr->IsPlayer() )
+    {
         mapPlayers.push_back( (Client*) cr );
+        WakeUp();
+    }
     if( cr->IsNpc() )
         mapNpcs.push_back( (Npc*) cr );
     mapCritters.push_back( cr );
@@ -355,7 +534,8 @@ void Map::SetItem( Item* item, ushort hx, ushort hy )
 
     mapItems.push_back( item );
     mapItemsById.insert( std::make_pair( item->GetId(), item ) );
-    mapItemsByHex.insert( std::make_pair( ( hy << 16 ) | hx, ItemVec() ) ).first->second.push_back( item );
+    mapItemsByHex.Add( hx, hy, item );
+    UpdateSpecialViewItem( item, false );
 
     if( item->GetIsGeck() )
         mapLocation->GeckCount++;
@@ -380,13 +560,8 @@ void Map::EraseItem( uint item_id )
 
     ushort hx = item->GetHexX();
     ushort hy = item->GetHexY();
-    auto   it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    RUNTIME_ASSERT( it_hex_all != mapItemsByHex.end() );
-    auto   it_hex = std::find( it_hex_all->second.begin(), it_hex_all->second.end(), item );
-    RUNTIME_ASSERT( it_hex != it_hex_all->second.end() );
-    it_hex_all->second.erase( it_hex );
-    if( it_hex_all->second.empty() )
-        mapItemsByHex.erase( it_hex_all );
+    mapItemsByHex.Remove( hx, hy, item );
+    UpdateSpecialViewItem( item, true );
 
     item->SetAccessory( ITEM_ACCESSORY_NONE );
     item->SetMapId( 0 );
@@ -443,8 +618,21 @@ void Map::SendProperty( NetProperty::Type type, Property* prop, Entity* entity )
     }
 }
 
+void Map::UpdateSpecialViewItem( Item* item, bool erase )
+{
+    // Items which visibility not depends only on distance, see Critter::ProcessVisibleItemsStep
+    bool special = ( !erase && ( item->GetIsAlwaysView() || item->GetIsTrap() ) );
+    auto it = std::find( mapSpecialViewItems.begin(), mapSpecialViewItems.end(), item );
+    if( special && it == mapSpecialViewItems.end() )
+        mapSpecialViewItems.push_back( item );
+    else if( !special && it != mapSpecialViewItems.end() )
+        mapSpecialViewItems.erase( it );
+}
+
 void Map::ChangeViewItem( Item* item )
 {
+    UpdateSpecialViewItem( item, false );
+
     for( Critter* cr : GetCritters() )
     {
         if( cr->CountIdVisItem( item->GetId() ) )
@@ -519,37 +707,27 @@ Item* Map::GetItem( uint item_id )
 
 Item* Map::GetItemHex( ushort hx, ushort hy, hash item_pid, Critter* picker )
 {
-    auto it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    if( it_hex_all != mapItemsByHex.end() )
+    for( Item* item : mapItemsByHex.Get( hx, hy ) )
     {
-        for( Item* item : it_hex_all->second )
-        {
-            if( ( item_pid == 0 || item->GetProtoId() == item_pid ) &&
-                ( !picker || ( !item->GetIsHidden() && picker->CountIdVisItem( item->GetId() ) ) ) )
-                return item;
-        }
+        if( ( item_pid == 0 || item->GetProtoId() == item_pid ) &&
+            ( !picker || ( !item->GetIsHidden() && picker->CountIdVisItem( item->GetId() ) ) ) )
+            return item;
     }
     return nullptr;
 }
 
 Item* Map::GetItemGag( ushort hx, ushort hy )
 {
-    auto it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    if( it_hex_all != mapItemsByHex.end() )
-    {
-        for( Item* item : it_hex_all->second )
-            if( item->GetIsGag() )
-                return item;
-    }
+    for( Item* item : mapItemsByHex.Get( hx, hy ) )
+        if( item->GetIsGag() )
+            return item;
     return nullptr;
 }
 
 void Map::GetItemsHex( ushort hx, ushort hy, ItemVec& items )
 {
-    auto it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    if( it_hex_all != mapItemsByHex.end() )
-        for( Item* item : it_hex_all->second )
-            items.push_back( item );
+    for( Item* item : mapItemsByHex.Get( hx, hy ) )
+        items.push_back( item );
 }
 
 void Map::GetItemsHexEx( ushort hx, ushort hy, uint radius, hash pid, ItemVec& items )
@@ -568,13 +746,9 @@ void Map::GetItemsPid( hash pid, ItemVec& items )
 
 void Map::GetItemsTrigger( ushort hx, ushort hy, ItemVec& traps )
 {
-    auto it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    if( it_hex_all != mapItemsByHex.end() )
-    {
-        for( Item* item : it_hex_all->second )
-            if( item->GetIsTrap() || item->GetIsTrigger() )
-                traps.push_back( item );
-    }
+    for( Item* item : mapItemsByHex.Get( hx, hy ) )
+        if( item->GetIsTrap() || item->GetIsTrigger() )
+            traps.push_back( item );
 }
 
 bool Map::IsPlaceForProtoItem( ushort hx, ushort hy, ProtoItem* proto_item )
@@ -593,7 +767,7 @@ void Map::PlaceItemBlocks( ushort hx, ushort hy, Item* item )
 {
     bool raked = item->GetIsShootThru();
     FOREACH_PROTO_ITEM_LINES( item->GetBlockLines(), hx, hy, GetWidth(), GetHeight(),
-                              mapBlockLinesByHex.insert( std::make_pair( ( hy << 16 ) | hx, ItemVec() ) ).first->second.push_back( item );
+                              mapBlockLinesByHex.Add( hx, hy, item );
 
                               RecacheHexFlags( hx, hy );
                               );
@@ -603,13 +777,7 @@ void Map::RemoveItemBlocks( ushort hx, ushort hy, Item* item )
 {
     bool raked = item->GetIsShootThru();
     FOREACH_PROTO_ITEM_LINES( item->GetBlockLines(), hx, hy, GetWidth(), GetHeight(),
-                              auto it_hex_all_bl = mapBlockLinesByHex.find( ( hy << 16 ) | hx );
-                              RUNTIME_ASSERT( it_hex_all_bl != mapBlockLinesByHex.end() );
-                              auto it_hex_bl = std::find( it_hex_all_bl->second.begin(), it_hex_all_bl->second.end(), item );
-                              RUNTIME_ASSERT( it_hex_bl != it_hex_all_bl->second.end() );
-                              it_hex_all_bl->second.erase( it_hex_bl );
-                              if( it_hex_all_bl->second.empty() )
-                                  mapBlockLinesByHex.erase( it_hex_all_bl );
+                              mapBlockLinesByHex.Remove( hx, hy, item );
 
                               RecacheHexFlags( hx, hy );
                               );
@@ -628,40 +796,32 @@ void Map::RecacheHexFlags( ushort hx, ushort hy )
     bool is_trap = false;
     bool is_trigger = false;
 
-    auto it_hex_all = mapItemsByHex.find( ( hy << 16 ) | hx );
-    if( it_hex_all != mapItemsByHex.end() )
+    for( Item* item : mapItemsByHex.Get( hx, hy ) )
     {
-        for( Item* item : it_hex_all->second )
-        {
-            if( !is_block && !item->GetIsNoBlock() )
-                is_block = true;
-            if( !is_nrake && !item->GetIsShootThru() )
-                is_nrake = true;
-            if( !is_gag && item->GetIsGag() )
-                is_gag = true;
-            if( !is_trap && item->GetIsTrap() )
-                is_trap = true;
-            if( !is_trigger && item->GetIsTrigger() )
-                is_trigger = true;
-            if( is_block && is_nrake && is_gag && is_trap && is_trigger )
-                break;
-        }
+        if( !is_block && !item->GetIsNoBlock() )
+            is_block = true;
+        if( !is_nrake && !item->GetIsShootThru() )
+            is_nrake = true;
+        if( !is_gag && item->GetIsGag() )
+            is_gag = true;
+        if( !is_trap && item->GetIsTrap() )
+            is_trap = true;
+        if( !is_trigger && item->GetIsTrigger() )
+            is_trigger = true;
+        if( is_block && is_nrake && is_gag && is_trap && is_trigger )
+            break;
     }
 
-    if( !is_block && !is_nrake )
+    if( !is_block && !is_nrake && !mapBlockLinesByHex.IsHexEmpty( hx, hy ) )
     {
-        auto it_hex_all_bl = mapBlockLinesByHex.find( ( hy << 16 ) | hx );
-        if( it_hex_all_bl != mapBlockLinesByHex.end() )
-        {
-            is_block = true;
+        is_block = true;
 
-            for( Item* item : it_hex_all_bl->second )
+        for( Item* item : mapBlockLinesByHex.Get( hx, hy ) )
+        {
+            if( !item->GetIsShootThru() )
             {
-                if( !item->GetIsShootThru() )
-                {
-                    is_nrake = true;
-                    break;
-                }
+                is_nrake = true;
+                break;
             }
         }
     }
@@ -1027,6 +1187,7 @@ Location::Location( uint id, ProtoLocation* proto ): Entity( id, EntityType::Loc
 {
     RUNTIME_ASSERT( proto );
     GeckCount = 0;
+    ZoneIndexed = false;
 }
 
 Location::~Location()
@@ -6,11 +6,67 @@
 #include "Item.h"
 #include "Critter.h"
 #include "Entity.h"
+#include "FlexRect.h"
 
 class Map;
 class Location;
 
-using ItemVecMap = map< uint, ItemVec >;
+// Items by hex, open addressing table of occupied hexes with item lists in shared node pool
+class HexItemIndex
+{
+public:
+    static const uint None = uint( -1 );
+
+private:
+    struct Bucket
+    {
+        uint Key;   // Hex + 1, zero for free bucket
+        uint Head;
+    };
+    struct Node
+    {
+        Item* Value;
+        uint  Next;
+    };
+
+    vector< Bucket > buckets;
+    vector< Node >   nodes;
+    uint             freeNode;
+    uint             usedBuckets;
+    uint             hashShift;  // 32 - log2( capacity )
+
+    static uint MakeKey( ushort hx, ushort hy ) { return ( ( hy << 16 ) | hx ) + 1; }
+    uint        FindBucket( uint key );
+    void        Rehash( uint capacity );
+
+public:
+    class Iterator
+    {
+        HexItemIndex* index;
+        uint          node;
+
+    public:
+        Iterator( HexItemIndex* index, uint node ): index( index ), node( node ) {}
+        Item*     operator*() const                  { return index->nodes[ node ].Value; }
+        Iterator& operator++()                       { node = index->nodes[ node ].Next; return *this; }
+        bool      operator!=( const Iterator& other ) const { return node != other.node; }
+    };
+
+    struct Range
+    {
+        Iterator First;
+        Iterator Last;
+        Iterator begin() const { return First; }
+        Iterator end() const   { return Last; }
+    };
+
+    HexItemIndex();
+    void  Add( ushort hx, ushort hy, Item* item );
+    void  Remove( ushort hx, ushort hy, Item* item );
+    bool  IsEmpty() { return usedBuckets == 0; }
+    bool  IsHexEmpty( ushort hx, ushort hy );
+    Range Get( ushort hx, ushort hy );
+};
 
 class Map: public Entity
 {
@@ -39,26 +95,32 @@ public:
     ~Map();
 
 private:
-    uchar*     hexFlags;
-    int        hexFlagsSize;
-    CrVec      mapCritters;
-    ClVec      mapPlayers;
-    PcVec      mapNpcs;
-    ItemVec    mapItems;
-    ItemMap    mapItemsById;
-    ItemVecMap mapItemsByHex;
-    ItemVecMap mapBlockLinesByHex;
-    Location*  mapLocation;
-    uint       loopLastTick[ 5 ];
+    uchar*       hexFlags;
+    int          hexFlagsSize;
+    CrVec        mapCritters;
+    ClVec        mapPlayers;
+    PcVec        mapNpcs;
+    ItemVec      mapItems;
+    ItemVec      mapSpecialViewItems;
+    ItemMap      mapItemsById;
+    HexItemIndex mapItemsByHex;
+    HexItemIndex mapBlockLinesByHex;
+    Location*    mapLocation;
+    uint         loopLastTick[ 5 ];
+    uint         lastActiveTick;
+    bool         isHibernated;
 
     void PlaceItemBlocks( ushort hx, ushort hy, Item* item );
     void RemoveItemBlocks( ushort hx, ushort hy, Item* item );
+    void UpdateSpecialViewItem( Item* item, bool erase );
 
 public:
     bool Generate();
     void DeleteContent();
     void Process();
     void ProcessLoop( int index, uint time, uint tick );
+    bool IsHibernated() { return isHibernated; }
+    void WakeUp();
 
     ProtoMap* GetProtoMap() { return (ProtoMap*) Proto; }
     Location* GetLocation();
@@ -86,6 +148,7 @@ public:
     Item* GetItemGag( ushort hx, ushort hy );
 
     ItemVec GetItems() { return mapItems; } // Make copy
+    ItemVec GetSpecialViewItems() { return mapSpecialViewItems; } // Make copy
     void    GetItemsHex( ushort hx, ushort hy, ItemVec& items );
     void    GetItemsHexEx( ushort hx, ushort hy, uint radius, hash pid, ItemVec& items );
     void    GetItemsPid( hash pid, ItemVec& items );
@@ -162,6 +225,8 @@ private:
 public:
     uint EntranceScriptBindId;
     int  GeckCount;
+    bool ZoneIndexed;   // See MapManager::IndexLocationZones
+    Rect ZoneIndexRect;
 
     void           BindScript();
     ProtoLocation* GetProtoLoc()  { return (ProtoLocation*) Proto; }
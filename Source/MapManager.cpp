@@ -41,6 +41,7 @@ bool MapManager::RestoreLocation( uint id, hash proto_id, const DataBase::Docume
 
     loc->BindScript();
     EntityMngr.RegisterEntity( loc );
+    IndexLocationZones( loc, true );
     return true;
 }
 
@@ -51,8 +52,13 @@ string MapManager::GetLocationsMapsStatistics()
     EntityVec maps;
     EntityMngr.GetEntities( EntityType::Map, maps );
 
+    uint hibernated = 0;
+    for( Entity* map : maps )
+        if( ( (Map*) map )->IsHibernated() )
+            hibernated++;
+
     string result = _str( "Locations count: {}\n", (uint) locations.size() );
-    result += _str( "Maps count: {}\n", (uint) maps.size() );
+    result += _str( "Maps count: {}, hibernated: {}\n", (uint) maps.size(), hibernated );
     result += "Location             Id           X     Y     Radius Color    Hidden  GeckVisible GeckCount AutoGarbage ToGarbage\n";
     result += "          Map                 Id          Time Rain Script\n";
     for( auto it = locations.begin(), end = locations.end(); it != end; ++it )
@@ -112,6 +118,7 @@ Location* MapManager::CreateLocation( hash loc_pid, ushort wx, ushort wy )
     loc->BindScript();
 
     EntityMngr.RegisterEntity( loc );
+    IndexLocationZones( loc, true );
 
     // Generate location maps
     MapVec maps = loc->GetMaps();
@@ -235,15 +242,25 @@ bool MapManager::IsIntersectZone( int wx1, int wy1, int w1_radius, int wx2, int
 
 void MapManager::GetZoneLocations( int zx, int zy, int zone_radius, UIntVec& loc_ids )
 {
-    LocVec locs;
-    EntityMngr.GetLocations( locs );
-    int    wx = zx * GM_ZONE_LEN;
-    int    wy = zy * GM_ZONE_LEN;
-    for( auto it = locs.begin(), end = locs.end(); it != end; ++it )
+    int  wx = zx * GM_ZONE_LEN;
+    int  wy = zy * GM_ZONE_LEN;
+    Rect zones( CLAMP( zx - zone_radius, 0, GM__MAXZONEX - 1 ), CLAMP( zy - zone_radius, 0, GM__MAXZONEY - 1 ),
+                CLAMP( zx + zone_radius, 0, GM__MAXZONEX - 1 ), CLAMP( zy + zone_radius, 0, GM__MAXZONEY - 1 ) );
+    for( int y = zones.T; y <= zones.B; y++ )
     {
-        Location* loc = *it;
-        if( loc->IsLocVisible() && IsIntersectZone( wx, wy, 0, loc->GetWorldX(), loc->GetWorldY(), loc->GetRadius(), zone_radius ) )
-            loc_ids.push_back( loc->GetId() );
+        for( int x = zones.L; x <= zones.R; x++ )
+        {
+            for( Location* loc : locZones[ y * GM__MAXZONEX + x ] )
+            {
+                // Location stored in every zone it covers, take it only from first overlapped one
+                const Rect& r = loc->ZoneIndexRect;
+                if( x != MAX( r.L, zones.L ) || y != MAX( r.T, zones.T ) )
+                    continue;
+
+                if( loc->IsLocVisible() && IsIntersectZone( wx, wy, 0, loc->GetWorldX(), loc->GetWorldY(), loc->GetRadius(), zone_radius ) )
+                    loc_ids.push_back( loc->GetId() );
+            }
+        }
     }
 }
 
@@ -257,6 +274,44 @@ uint MapManager::GetLocationsCount()
     return EntityMngr.GetEntitiesCount( EntityType::Location );
 }
 
+void MapManager::IndexLocationZones( Location* loc, bool add )
+{
+    if( loc->ZoneIndexed )
+    {
+        const Rect& r = loc->ZoneIndexRect;
+        for( int y = r.T; y <= r.B; y++ )
+        {
+            for( int x = r.L; x <= r.R; x++ )
+            {
+                LocVec& zone = locZones[ y * GM__MAXZONEX + x ];
+                auto    it = std::find( zone.begin(), zone.end(), loc );
+                RUNTIME_ASSERT( it != zone.end() );
+                *it = zone.back();
+                zone.pop_back();
+            }
+        }
+        loc->ZoneIndexed = false;
+    }
+
+    if( add )
+    {
+        // Same zone bounds as in IsIntersectZone, clamped to world
+        int   zl = GM_ZONE_LEN;
+        int   wx = loc->GetWorldX();
+        int   wy = loc->GetWorldY();
+        int   radius = loc->GetRadius();
+        Rect& r = loc->ZoneIndexRect;
+        r.L = CLAMP( ( wx - radius ) / zl, 0, GM__MAXZONEX - 1 );
+        r.T = CLAMP( ( wy - radius ) / zl, 0, GM__MAXZONEY - 1 );
+        r.R = CLAMP( ( wx + radius ) / zl, 0, GM__MAXZONEX - 1 );
+        r.B = CLAMP( ( wy + radius ) / zl, 0, GM__MAXZONEY - 1 );
+        for( int y = r.T; y <= r.B; y++ )
+            for( int x = r.L; x <= r.R; x++ )
+                locZones[ y * GM__MAXZONEX + x ].push_back( loc );
+        loc->ZoneIndexed = true;
+    }
+}
+
 void MapManager::LocationGarbager()
 {
     if( runGarbager )
@@ -318,6 +373,7 @@ void MapManager::DeleteLocation( Location* loc, ClVec* gmap_players )
     loc->GetMapsRaw().clear();
 
     // Erase from main collections
+    IndexLocationZones( loc, false );
     EntityMngr.UnregisterEntity( loc );
     for( auto it = maps.begin(); it != maps.end(); ++it )
         EntityMngr.UnregisterEntity( *it );
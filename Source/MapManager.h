@@ -101,6 +101,7 @@ public:
     // Locations
 private:
     volatile bool runGarbager;
+    LocVec        locZones[ GM__MAXZONEX * GM__MAXZONEY ];
 
 public:
     Location* CreateLocation( hash proto_id, ushort wx, ushort wy );
@@ -112,6 +113,7 @@ public:
     uint      GetLocationsCount();
     void      LocationGarbager();
     void      DeleteLocation( Location* loc, ClVec* gmap_players );
+    void      IndexLocationZones( Location* loc, bool add );
     void      RunGarbager() { runGarbager = true; }
 
     // Maps
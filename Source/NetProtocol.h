@@ -9,6 +9,7 @@
 
 #define MAKE_NETMSG_HEADER( number )    ( (uint) ( ( 0x5EAD << 16 ) | ( ( number ) << 8 ) | ( 0xAA ) ) )
 #define PING_CLIENT_LIFE_TIME               ( 15000 )       // Time to ping client life
+#define UDP_HELLO_TIME                      ( 2000 )        // Client resends session to unreliable channel, keeps NAT mapping
 
 // Special message
 // 0xFFFFFFFF - ping, answer
@@ -42,6 +43,7 @@
 // Login accepted
 // uint bin_seed
 // uint bout_seed
+// uint udp_session (zero if unreliable channel is not available)
 // Properties global
 // ////////////////////////////////////////////////////////////////////////
 
@@ -292,20 +294,21 @@
 // ////////////////////////////////////////////////////////////////////////
 
 #define NETMSG_CRITTER_MOVE                 MAKE_NETMSG_HEADER( 45 )
-#define NETMSG_CRITTER_MOVE_SIZE            ( sizeof( uint ) + sizeof( uint ) * 2 + sizeof( ushort ) * 2 )
+#define NETMSG_CRITTER_MOVE_SIZE            ( sizeof( uint ) + sizeof( uint ) * 3 + sizeof( ushort ) * 2 )
 // ////////////////////////////////////////////////////////////////////////
-//
+// Also sent as single datagram through unreliable channel
 // Params:
 // uint id
 // uint move_params
 // ushort hx
 // ushort hy
+// uint seq (zero if unsequenced, older than last received are dropped)
 // ////////////////////////////////////////////////////////////////////////
 
 #define NETMSG_CRITTER_XY                   MAKE_NETMSG_HEADER( 46 )
 #define NETMSG_CRITTER_XY_SIZE          \
     ( sizeof( uint ) + sizeof( uint ) + \
-      sizeof( ushort ) * 2 + sizeof( uchar ) )
+      sizeof( ushort ) * 2 + sizeof( uchar ) + sizeof( uint ) )
 // ////////////////////////////////////////////////////////////////////////
 //
 // Params:
@@ -313,6 +316,7 @@
 // ushort hex_x
 // ushort hex_y
 // uchar dir
+// uint seq (same sequence as NETMSG_CRITTER_MOVE)
 // ////////////////////////////////////////////////////////////////////////
 
 // ************************************************************************
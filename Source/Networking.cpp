@@ -21,9 +21,99 @@ static void  ZlibFree( void* opaque, void* address )                          {
 
 NetConnection::~NetConnection() {}
 
+// Unreliable channel peers, bound to client endpoint by hello datagram with session
+struct UdpPeer
+{
+    string                  Host;
+    bool                    Bound;
+    asio::ip::udp::endpoint Endpoint;
+};
+typedef map< uint, UdpPeer > UdpPeerMap;
+
+class NetUdpServer;
+static Mutex         UdpPeersLocker;
+static UdpPeerMap    UdpPeers;
+static NetUdpServer* UdpServer;
+
+class NetUdpServer: public NetServerBase
+{
+    asio::io_service        ioService;
+    asio::ip::udp::socket   socket;
+    asio::ip::udp::endpoint remoteEndpoint;
+    uchar                   inBuf[ 64 ];
+    std::thread             runThread;
+
+    void Run()
+    {
+        asio::error_code error;
+        ioService.run( error );
+    }
+
+    void NextReceive()
+    {
+        socket.async_receive_from( asio::buffer( inBuf ), remoteEndpoint,
+                                   std::bind( &NetUdpServer::Receive, this, std::placeholders::_1, std::placeholders::_2 ) );
+    }
+
+    void Receive( std::error_code error, size_t bytes )
+    {
+        if( error == asio::error::operation_aborted )
+            return;
+
+        // Hello from client, accept only from same host as reliable connection
+        if( !error && bytes == sizeof( uint ) )
+        {
+            uint session;
+            memcpy( &session, inBuf, sizeof( session ) );
+
+            SCOPE_LOCK( UdpPeersLocker );
+            auto it = UdpPeers.find( session );
+            if( it != UdpPeers.end() && it->second.Host == remoteEndpoint.address().to_string() )
+            {
+                it->second.Endpoint = remoteEndpoint;
+                it->second.Bound = true;
+            }
+        }
+
+        NextReceive();
+    }
+
+public:
+    NetUdpServer( ushort port ): socket( ioService, asio::ip::udp::endpoint( asio::ip::udp::v6(), port ) )
+    {
+        NextReceive();
+        runThread = std::thread( &NetUdpServer::Run, this );
+
+        SCOPE_LOCK( UdpPeersLocker );
+        UdpServer = this;
+    }
+
+    virtual ~NetUdpServer() override
+    {
+        UdpPeersLocker.Lock();
+        UdpServer = nullptr;
+        UdpPeersLocker.Unlock();
+
+        ioService.stop();
+        runThread.join();
+    }
+
+    // Called under peers lock, socket itself is touched only from io thread
+    bool Send( const asio::ip::udp::endpoint& endpoint, const void* data, uint len )
+    {
+        auto buf = std::make_shared< UCharVec >( (const uchar*) data, (const uchar*) data + len );
+        ioService.post([ this, endpoint, buf ] ()
+                       {
+                           socket.async_send_to( asio::buffer( *buf ), endpoint, [ buf ] ( std::error_code, size_t ) {} );
+                       } );
+        return true;
+    }
+};
+
 class NetConnectionImpl: public NetConnection
 {
     z_stream* zStream;
+    int       zLevel;
     uchar     outBuf[ BufferManager::DefaultBufSize ];
 
 public:
@@ -31,17 +121,31 @@ public:
     {
         IsDisconnected = false;
         DisconnectTick = 0;
+        StatBytesSend = 0;
+        StatBytesSendReal = 0;
+        StatBytesRecv = 0;
+        UdpSession = 0;
         zStream = nullptr;
+        zLevel = Z_BEST_SPEED;
         memzero( outBuf, sizeof( outBuf ) );
 
         if( !GameOpt.DisableZlibCompression )
         {
+            zLevel = CLAMP( GameOpt.ZlibCompressionLevel, Z_BEST_SPEED, Z_BEST_COMPRESSION );
             zStream = new z_stream();
             zStream->zalloc = ZlibAlloc;
             zStream->zfree = ZlibFree;
             zStream->opaque = nullptr;
-            int result = deflateInit( zStream, Z_BEST_SPEED );
+            int result = deflateInit( zStream, zLevel );
             RUNTIME_ASSERT( result == Z_OK );
+
+            // Client sets same dictionary when inflate asks for it
+            if( GameOpt.ZlibCompressionDictionary )
+            {
+                const UCharVec& dict = BufferManager::GetCompressionDictionary();
+                result = deflateSetDictionary( zStream, &dict[ 0 ], (uint) dict.size() );
+                RUNTIME_ASSERT( result == Z_OK );
+            }
         }
     }
 
@@ -53,6 +157,12 @@ public:
         if( zStream )
             deflateEnd( zStream );
         SAFEDEL( zStream );
+
+        if( UdpSession )
+        {
+            SCOPE_LOCK( UdpPeersLocker );
+            UdpPeers.erase( UdpSession );
+        }
     }
 
     virtual void DisableCompression() override
@@ -91,6 +201,36 @@ public:
         DisconnectImpl();
     }
 
+    virtual uint EnableUdp() override
+    {
+        SCOPE_LOCK( UdpPeersLocker );
+        if( UdpSession || !UdpServer )
+            return UdpSession;
+
+        uint session;
+        do
+            session = Random( 1, 0x7FFFFFFF );
+        while( UdpPeers.count( session ) );
+
+        UdpPeer& peer = UdpPeers[ session ];
+        peer.Host = Host;
+        peer.Bound = false;
+        UdpSession = session;
+        return session;
+    }
+
+    virtual bool SendUdp( const void* data, uint len ) override
+    {
+        if( !UdpSession || IsDisconnected )
+            return false;
+
+        SCOPE_LOCK( UdpPeersLocker );
+        auto it = UdpPeers.find( UdpSession );
+        if( !UdpServer || it == UdpPeers.end() || !it->second.Bound )
+            return false;
+        return UdpServer->Send( it->second.Endpoint, data, len );
+    }
+
 protected:
     virtual void DispatchImpl() = 0;
     virtual void DisconnectImpl() = 0;
@@ -107,33 +247,51 @@ protected:
         // Compress
         if( zStream )
         {
-            uint to_compr = Bout.GetEndPos();
+            uint to_compr = Bout.GetUnreadLen();
             if( to_compr > sizeof( outBuf ) - 32 )
                 to_compr = sizeof( outBuf ) - 32;
 
-            zStream->next_in = Bout.GetCurData();
-            zStream->avail_in = to_compr;
             zStream->next_out = outBuf;
             zStream->avail_out = sizeof( outBuf );
 
+            // Tiny frames go as stored blocks, it keeps stream valid but saves compression time
+            // Level must be changed without pending input, otherwise zlib flushes it with previous level
+            int level = CLAMP( GameOpt.ZlibCompressionLevel, Z_BEST_SPEED, Z_BEST_COMPRESSION );
+            if( to_compr < GameOpt.ZlibCompressionMinSize )
+                level = Z_NO_COMPRESSION;
+            if( level != zLevel )
+            {
+                zStream->next_in = nullptr;
+                zStream->avail_in = 0;
+                int result = deflateParams( zStream, level, Z_DEFAULT_STRATEGY );
+                RUNTIME_ASSERT( result == Z_OK || result == Z_BUF_ERROR );
+                zLevel = level;
+            }
+
+            zStream->next_in = Bout.GetCurData();
+            zStream->avail_in = to_compr;
+
             int result = deflate( zStream, Z_SYNC_FLUSH );
-            RUNTIME_ASSERT( result == Z_OK );
+            RUNTIME_ASSERT( result == Z_OK || result == Z_BUF_ERROR );
 
             uint compr = (uint) ( (size_t) zStream->next_out - (size_t) outBuf );
             uint real = (uint) ( (size_t) zStream->next_in - (size_t) Bout.GetCurData() );
             out_len = compr;
             Bout.Cut( real );
+            StatBytesSendReal += real;
         }
         // Without compressing
         else
         {
-            uint len = Bout.GetEndPos();
+            uint len = Bout.GetUnreadLen();
             if( len > sizeof( outBuf ) )
                 len = sizeof( outBuf );
             memcpy( outBuf, Bout.GetCurData(), len );
             out_len = len;
             Bout.Cut( len );
+            StatBytesSendReal += len;
         }
+        StatBytesSend += out_len;
 
         // Normalize buffer size
         if( Bout.IsEmpty() )
@@ -156,6 +314,7 @@ protected:
             return;
         }
         Bin.Push( buf, len, true );
+        StatBytesRecv += len;
         Bin.Unlock();
     }
 };
@@ -348,6 +507,12 @@ class NetConnectionWS: public NetConnectionImpl
         connection->terminate( error );
     }
 
+    // Browsers have no datagram sockets
+    virtual uint EnableUdp() override
+    {
+        return 0;
+    }
+
 public:
     NetConnectionWS( web_sockets* server, web_sockets::connection_ptr connection ): server( server ), connection( connection )
     {
@@ -440,3 +605,16 @@ NetServerBase* NetServerBase::StartWebSocketsServer( ushort port, std::function<
         return nullptr;
     }
 }
+
+NetServerBase* NetServerBase::StartUdpServer( ushort port )
+{
+    try
+    {
+        return new NetUdpServer( port );
+    }
+    catch( const std::exception& ex )
+    {
+        WriteLog( "Can't start Udp server: {}.\n", ex.what() );
+        return nullptr;
+    }
+}
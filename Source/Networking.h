@@ -17,10 +17,20 @@ public:
     bool          IsDisconnected;
     uint          DisconnectTick;
 
+    // Traffic counters, guarded by Bout and Bin locks, collected and reset by owner
+    uint          StatBytesSend;
+    uint          StatBytesSendReal;
+    uint          StatBytesRecv;
+
+    // Unreliable datagram channel for superseding state, zero if not negotiated
+    uint          UdpSession;
+
     virtual ~NetConnection() = 0;
     virtual void DisableCompression() = 0;
     virtual void Dispatch() = 0;
     virtual void Disconnect() = 0;
+    virtual uint EnableUdp() = 0;
+    virtual bool SendUdp( const void* data, uint len ) = 0;
 };
 
 class NetServerBase
@@ -30,6 +40,7 @@ public:
 
     static NetServerBase* StartTcpServer( ushort port, std::function< void(NetConnection*) > callback );
     static NetServerBase* StartWebSocketsServer( ushort port, std::function< void(NetConnection*) > callback );
+    static NetServerBase* StartUdpServer( ushort port );
 };
 
 #endif // __NETWORKING__
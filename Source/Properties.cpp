@@ -6,6 +6,8 @@
 #include "DataBase.h"
 
 NativeCallbackVec PropertyRegistrator::GlobalSetCallbacks;
+bool              PropertyRegistrator::deferredSendEnabled;
+vector< Entity* > PropertyRegistrator::deferredSendEntities;
 
 Property::Property()
 {
@@ -746,8 +748,30 @@ void Property::GenericSet( Entity* entity, void* new_value )
     // Native send callback
     if( nativeSendCallback && !( this == properties->sendIgnoreProperty && entity == properties->sendIgnoreEntity ) )
     {
-        if( ( properties->registrator->isServer && ( accessType & ( Property::PublicMask | Property::ProtectedMask ) ) ) ||
-            ( !properties->registrator->isServer && ( accessType & Property::ModifiableMask ) ) )
+        if( properties->registrator->isServer && ( accessType & ( Property::PublicMask | Property::ProtectedMask ) ) )
+        {
+            // Collect changes and send only last value at flush
+            if( PropertyRegistrator::deferredSendEnabled )
+            {
+                if( properties->sendDirty.empty() )
+                    properties->sendDirty.resize( properties->registrator->registeredProperties.size() );
+                if( !properties->sendDirty[ regIndex ] )
+                {
+                    if( properties->sendDirtyProps.empty() )
+                    {
+                        entity->AddRef();
+                        PropertyRegistrator::deferredSendEntities.push_back( entity );
+                    }
+                    properties->sendDirty[ regIndex ] = true;
+                    properties->sendDirtyProps.push_back( regIndex );
+                }
+            }
+            else
+            {
+                nativeSendCallback( entity, this );
+            }
+        }
+        else if( !properties->registrator->isServer && ( accessType & Property::ModifiableMask ) )
         {
             nativeSendCallback( entity, this );
         }
@@ -1269,6 +1293,49 @@ void Properties::RestoreData( UCharVecVec& all_data )
     RestoreData( all_data_ext, all_data_sizes );
 }
 
+void Properties::StoreAllData( UCharVec& data )
+{
+    // Including private data, only for local caches
+    WriteData( data, registrator->wholePodDataSize );
+    WriteDataArr( data, podData, registrator->wholePodDataSize );
+    WriteData( data, (uint) complexData.size() );
+    for( size_t i = 0; i < complexData.size(); i++ )
+    {
+        WriteData( data, complexDataSizes[ i ] );
+        WriteDataArr( data, complexData[ i ], complexDataSizes[ i ] );
+    }
+}
+
+bool Properties::RestoreAllData( UCharVec& data, uint& pos )
+{
+    uint   pod_size;
+    uchar* pod_data;
+    if( !ReadDataSafe( data, pos, pod_size ) || pod_size != registrator->wholePodDataSize || !ReadDataArrSafe( data, pod_size, pos, pod_data ) )
+        return false;
+    if( pod_size )
+        memcpy( podData, pod_data, pod_size );
+
+    uint complex_count;
+    if( !ReadDataSafe( data, pos, complex_count ) || complex_count != (uint) complexData.size() )
+        return false;
+    for( uint i = 0; i < complex_count; i++ )
+    {
+        uint   size;
+        uchar* complex_data;
+        if( !ReadDataSafe( data, pos, size ) || !ReadDataArrSafe( data, size, pos, complex_data ) )
+            return false;
+
+        SAFEDELA( complexData[ i ] );
+        complexDataSizes[ i ] = size;
+        if( size )
+        {
+            complexData[ i ] = new uchar[ size ];
+            memcpy( complexData[ i ], complex_data, size );
+        }
+    }
+    return true;
+}
+
 static const char* ReadToken( const char* str, string& result )
 {
     if( !*str )
@@ -3567,6 +3634,43 @@ void PropertyRegistrator::SetNativeSendCallback( NativeSendCallback callback )
         prop->nativeSendCallback = callback;
 }
 
+void PropertyRegistrator::SetDeferredSend( bool enabled )
+{
+    if( !enabled )
+        FlushDeferredSend();
+    deferredSendEnabled = enabled;
+}
+
+void PropertyRegistrator::FlushDeferredSend()
+{
+    // Send callbacks may raise events that change other properties, new changes collected to next pass
+    while( !deferredSendEntities.empty() )
+    {
+        vector< Entity* > entities;
+        entities.swap( deferredSendEntities );
+        for( Entity* entity : entities )
+        {
+            Properties& props = entity->Props;
+            UIntVec     dirty_props;
+            dirty_props.swap( props.sendDirtyProps );
+            for( uint reg_index : dirty_props )
+                props.sendDirty[ reg_index ] = false;
+
+            if( !entity->IsDestroyed )
+            {
+                for( uint reg_index : dirty_props )
+                {
+                    Property* prop = props.registrator->registeredProperties[ reg_index ];
+                    if( prop->nativeSendCallback )
+                        prop->nativeSendCallback( entity, prop );
+                }
+            }
+
+            entity->Release();
+        }
+    }
+}
+
 uint PropertyRegistrator::GetWholeDataSize()
 {
     return wholePodDataSize;
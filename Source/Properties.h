@@ -210,6 +210,8 @@ public:
     uint                 StoreData( bool with_protected, PUCharVec** all_data, UIntVec** all_data_sizes );
     void                 RestoreData( PUCharVec& all_data, UIntVec& all_data_sizes );
     void                 RestoreData( UCharVecVec& all_data );
+    void                 StoreAllData( UCharVec& data );
+    bool                 RestoreAllData( UCharVec& data, uint& pos );
     bool                 LoadFromText( const StrMap& key_values );
     void                 SaveToText( StrMap& key_values, Properties* base );
     DataBase::Document   SaveToDbDocument( Properties* base );
@@ -281,6 +283,8 @@ private:
     bool*                getCallbackLocked;
     Entity*              sendIgnoreEntity;
     Property*            sendIgnoreProperty;
+    BoolVec              sendDirty;
+    UIntVec              sendDirtyProps;
 };
 
 template< >
@@ -317,8 +321,13 @@ public:
     string    GetClassName();
 
     static NativeCallbackVec GlobalSetCallbacks;
+    static void              SetDeferredSend( bool enabled );
+    static void              FlushDeferredSend();
 
 private:
+    static bool              deferredSendEnabled;
+    static vector< Entity* > deferredSendEntities;
+
     bool                         registrationFinished;
     bool                         isServer;
     string                       scriptClassName;
@@ -1,4 +1,5 @@
 #include "ProtoManager.h"
+#include "Script.h"
 
 ProtoManager ProtoMngr;
 
@@ -307,6 +308,16 @@ void ProtoManager::ClearProtos()
     locProtos.clear();
 }
 
+int ProtoManager::ParseProtosFromFiles()
+{
+    int errors = 0;
+    errors += ParseProtos( "foitem", "ProtoItem", itemProtos );
+    errors += ParseProtos( "focr", "ProtoCritter", crProtos );
+    errors += ParseProtos( "fomap", "ProtoMap", mapProtos );
+    errors += ParseProtos( "foloc", "ProtoLocation", locProtos );
+    return errors;
+}
+
 bool ProtoManager::LoadProtosFromFiles()
 {
     WriteLog( "Load prototypes...\n" );
@@ -315,10 +326,19 @@ bool ProtoManager::LoadProtosFromFiles()
 
     // Load protos
     int errors = 0;
-    errors += ParseProtos( "foitem", "ProtoItem", itemProtos );
-    errors += ParseProtos( "focr", "ProtoCritter", crProtos );
-    errors += ParseProtos( "fomap", "ProtoMap", mapProtos );
-    errors += ParseProtos( "foloc", "ProtoLocation", locProtos );
+    #ifdef FONLINE_SERVER
+    if( !LoadProtosCache() )
+    {
+        StrSet hash_names;
+        _str::recordHashes( &hash_names );
+        errors = ParseProtosFromFiles();
+        _str::recordHashes( nullptr );
+        if( !errors )
+            SaveProtosCache( hash_names );
+    }
+    #else
+    errors = ParseProtosFromFiles();
+    #endif
     if( errors )
         return false;
 
@@ -384,6 +404,194 @@ bool ProtoManager::LoadProtosFromFiles()
     return true;
 }
 
+#ifdef FONLINE_SERVER
+# define PROTOS_CACHE_NAME         "Cache/Protos.fobin"
+# define PROTOS_CACHE_SIGNATURE    ( 0x46504201 ) // 'FPB' + format version
+
+static uint64 GetRegistratorHash( PropertyRegistrator* registrator )
+{
+    string layout = _str( "{} {}\n", registrator->GetClassName(), registrator->GetWholeDataSize() );
+    for( uint i = 0; i < registrator->GetCount(); i++ )
+    {
+        Property* prop = registrator->Get( i );
+        layout += _str( "{} {} {} {}\n", prop->GetName(), prop->GetTypeName(), (int) prop->GetAccess(), prop->GetRegIndex() );
+    }
+    return Crypt.MurmurHash2_64( (const uchar*) layout.c_str(), (uint) layout.length() );
+}
+
+static uint64 GetProtoSourcesHash( const char* ext )
+{
+    // Names and content of all files with given extension
+    uint64          result = 0;
+    FilesCollection files( ext );
+    while( files.IsNextFile() )
+    {
+        string       name;
+        FileManager& file = files.GetNextFile( &name );
+        result = result * 31 + Crypt.MurmurHash2_64( (const uchar*) name.c_str(), (uint) name.length() );
+        if( file.IsLoaded() )
+            result = result * 31 + Crypt.MurmurHash2_64( file.GetBuf(), file.GetFsize() );
+    }
+    return result;
+}
+
+template< class T >
+static void WriteProtosCache( UCharVec& data, const map< hash, T* >& protos )
+{
+    WriteData( data, (uint) protos.size() );
+    for( auto& kv : protos )
+    {
+        T* proto = kv.second;
+        WriteData( data, proto->ProtoId );
+
+        WriteData( data, (uint) proto->Components.size() );
+        for( hash component : proto->Components )
+            WriteData( data, component );
+
+        proto->Props.StoreAllData( data );
+
+        WriteData( data, (uint) proto->Texts.size() );
+        for( size_t i = 0; i < proto->Texts.size(); i++ )
+        {
+            UCharVec msg_data;
+            proto->Texts[ i ]->GetBinaryData( msg_data );
+            WriteData( data, proto->TextsLang[ i ] );
+            WriteData( data, (uint) msg_data.size() );
+            WriteDataArr( data, &msg_data[ 0 ], (uint) msg_data.size() );
+        }
+    }
+}
+
+template< class T >
+static bool ReadProtosCache( UCharVec& data, uint& pos, map< hash, T* >& protos )
+{
+    uint protos_count;
+    if( !ReadDataSafe( data, pos, protos_count ) )
+        return false;
+    for( uint i = 0; i < protos_count; i++ )
+    {
+        hash pid;
+        if( !ReadDataSafe( data, pos, pid ) || protos.count( pid ) )
+            return false;
+
+        T* proto = new T( pid );
+        protos.insert( std::make_pair( pid, proto ) );
+
+        uint components_count;
+        if( !ReadDataSafe( data, pos, components_count ) )
+            return false;
+        for( uint j = 0; j < components_count; j++ )
+        {
+            hash component;
+            if( !ReadDataSafe( data, pos, component ) )
+                return false;
+            proto->Components.insert( component );
+        }
+
+        if( !proto->Props.RestoreAllData( data, pos ) )
+            return false;
+
+        uint texts_count;
+        if( !ReadDataSafe( data, pos, texts_count ) )
+            return false;
+        for( uint j = 0; j < texts_count; j++ )
+        {
+            uint   lang;
+            uint   msg_size;
+            uchar* msg_data;
+            if( !ReadDataSafe( data, pos, lang ) || !ReadDataSafe( data, pos, msg_size ) || !ReadDataArrSafe( data, msg_size, pos, msg_data ) )
+                return false;
+
+            FOMsg* msg = new FOMsg();
+            proto->TextsLang.push_back( lang );
+            proto->Texts.push_back( msg );
+            if( !msg->LoadFromBinaryData( UCharVec( msg_data, msg_data + msg_size ) ) )
+                return false;
+        }
+    }
+    return true;
+}
+
+bool ProtoManager::LoadProtosCache()
+{
+    // Everything that affects parsed values, except map and location sources
+    uint64 parse_hash = FONLINE_VERSION;
+    parse_hash = parse_hash * 31 + Script::GetEnumValuesHash();
+    parse_hash = parse_hash * 31 + GetRegistratorHash( Item::PropertiesRegistrator );
+    parse_hash = parse_hash * 31 + GetRegistratorHash( Critter::PropertiesRegistrator );
+    parse_hash = parse_hash * 31 + GetRegistratorHash( Map::PropertiesRegistrator );
+    parse_hash = parse_hash * 31 + GetRegistratorHash( Location::PropertiesRegistrator );
+
+    // Map entities store whole item and critter prototype data
+    mapsHash = parse_hash;
+    mapsHash = mapsHash * 31 + GetProtoSourcesHash( "foitem" );
+    mapsHash = mapsHash * 31 + GetProtoSourcesHash( "focr" );
+
+    protosHash = mapsHash;
+    protosHash = protosHash * 31 + GetProtoSourcesHash( "fomap" );
+    protosHash = protosHash * 31 + GetProtoSourcesHash( "foloc" );
+
+    FileManager cache;
+    if( !cache.LoadFile( FileManager::GetWritePath( PROTOS_CACHE_NAME ) ) )
+        return false;
+
+    UCharVec data( cache.GetBuf(), cache.GetBuf() + cache.GetFsize() );
+    uint     pos = 0;
+    uint     signature;
+    uint64   key;
+    if( !ReadDataSafe( data, pos, signature ) || signature != PROTOS_CACHE_SIGNATURE || !ReadDataSafe( data, pos, key ) || key != protosHash )
+        return false;
+
+    // Names of hashes, that registered while parsing text
+    uint hash_names_count;
+    bool ok = ReadDataSafe( data, pos, hash_names_count );
+    for( uint i = 0; ok && i < hash_names_count; i++ )
+    {
+        uint  len;
+        char* name;
+        ok = ( ReadDataSafe( data, pos, len ) && ReadDataArrSafe( data, len, pos, name ) );
+        if( ok )
+            _str( string( name, len ) ).toHash();
+    }
+
+    ok = ( ok && ReadProtosCache( data, pos, itemProtos ) && ReadProtosCache( data, pos, crProtos ) &&
+           ReadProtosCache( data, pos, mapProtos ) && ReadProtosCache( data, pos, locProtos ) && pos == data.size() );
+    if( !ok )
+    {
+        WriteLog( "Prototypes cache is corrupted, parse from sources.\n" );
+        ClearProtos();
+        return false;
+    }
+
+    WriteLog( "Prototypes loaded from cache.\n" );
+    return true;
+}
+
+void ProtoManager::SaveProtosCache( const StrSet& hash_names )
+{
+    UCharVec data;
+    WriteData( data, (uint) PROTOS_CACHE_SIGNATURE );
+    WriteData( data, protosHash );
+
+    WriteData( data, (uint) hash_names.size() );
+    for( const string& name : hash_names )
+    {
+        WriteData( data, (uint) name.length() );
+        WriteDataArr( data, name.c_str(), (uint) name.length() );
+    }
+
+    WriteProtosCache( data, itemProtos );
+    WriteProtosCache( data, crProtos );
+    WriteProtosCache( data, mapProtos );
+    WriteProtosCache( data, locProtos );
+
+    FileManager cache;
+    cache.SetData( &data[ 0 ], (uint) data.size() );
+    if( !cache.SaveFile( PROTOS_CACHE_NAME ) )
+        WriteLog( "Unable to write prototypes cache.\n" );
+}
+#endif
+
 void ProtoManager::GetBinaryData( UCharVec& data )
 {
     data.clear();
@@ -19,6 +19,16 @@ private:
     ProtoMapMap     mapProtos;
     ProtoLocMap     locProtos;
 
+    int ParseProtosFromFiles();
+
+    #ifdef FONLINE_SERVER
+    uint64 protosHash;
+    uint64 mapsHash;
+
+    bool LoadProtosCache();
+    void SaveProtosCache( const StrSet& hash_names );
+    #endif
+
 public:
     void ClearProtos();
     bool LoadProtosFromFiles();
@@ -35,6 +45,10 @@ public:
     const ProtoCritterMap& GetProtoCritters()  { return crProtos; }
     const ProtoMapMap&     GetProtoMaps()      { return mapProtos; }
     const ProtoLocMap&     GetProtoLocations() { return locProtos; }
+
+    #ifdef FONLINE_SERVER
+    uint64 GetMapsHash() { return mapsHash; } // Everything map caches depend on, except map file itself
+    #endif
 };
 
 extern ProtoManager ProtoMngr;
@@ -138,10 +138,9 @@ void ProtoMap::SaveTextFormat( IniParser& file )
 }
 #endif
 
-bool ProtoMap::LoadTextFormat( const char* buf )
+bool ProtoMap::LoadTextFormat( const char* buf, EntityVec& entities )
 {
-    int       errors = 0;
-    EntityVec entities;
+    int errors = 0;
 
     // Header
     IniParser map_data;
@@ -261,12 +260,10 @@ bool ProtoMap::LoadTextFormat( const char* buf )
         Tiles.push_back( Tile( name, hx, hy, ox, oy, layer, is_roof ) );
     }
 
-    if( errors )
-        return false;
-    return OnAfterLoad( entities );
+    return errors == 0;
 }
 
-bool ProtoMap::LoadOldTextFormat( const char* buf )
+bool ProtoMap::LoadOldTextFormat( const char* buf, EntityVec& entities )
 {
     #define MAP_OBJECT_CRITTER                   ( 0 )
     #define MAP_OBJECT_ITEM                      ( 1 )
@@ -486,7 +483,6 @@ bool ProtoMap::LoadOldTextFormat( const char* buf )
         string FuncName;
     };
     vector< AdditionalFields > entities_addon;
-    EntityVec entities;
     string objects_str = map_ini.GetAppContent( "Objects" );
     if( !objects_str.empty() )
     {
@@ -762,7 +758,7 @@ bool ProtoMap::LoadOldTextFormat( const char* buf )
         }
     }
 
-    return OnAfterLoad( entities );
+    return true;
 }
 
 bool ProtoMap::OnAfterLoad( EntityVec& entities )
@@ -994,23 +990,176 @@ bool ProtoMap::Load()
     // Store path
     SetFileDir( _str( path ).extractDir() );
 
+    EntityVec entities;
+
+    // Load from binary cache
+    #ifdef FONLINE_SERVER
+    string cache_name = _str( "Cache/Maps/{}.fomapb", GetName() );
+    uint64 cache_key = ProtoMngr.GetMapsHash() * 31 + Crypt.MurmurHash2_64( map_file.GetBuf(), map_file.GetFsize() );
+    if( LoadCache( cache_name, cache_key, entities ) )
+        return OnAfterLoad( entities );
+
+    StrSet hash_names;
+    _str::recordHashes( &hash_names );
+    #endif
+
     // Load from file
     const char* data = map_file.GetCStr();
     bool is_old_format = ( strstr( data, "[Header]" ) && strstr( data, "[Tiles]" ) && strstr( data, "[Objects]" ) );
-    if( is_old_format && !LoadOldTextFormat( data ) )
+    bool loaded = ( is_old_format ? LoadOldTextFormat( data, entities ) : LoadTextFormat( data, entities ) );
+
+    #ifdef FONLINE_SERVER
+    _str::recordHashes( nullptr );
+    if( loaded )
+        SaveCache( cache_name, cache_key, hash_names, entities );
+    #endif
+
+    if( !loaded )
     {
-        WriteLog( "Unable to load map '{}' from old map format.\n", GetName() );
+        if( is_old_format )
+            WriteLog( "Unable to load map '{}' from old map format.\n", GetName() );
+        else
+            WriteLog( "Unable to load map '{}'.\n", GetName() );
+        for( auto& entity : entities )
+            entity->Release();
+        return false;
+    }
+
+    return OnAfterLoad( entities );
+}
+
+#ifdef FONLINE_SERVER
+# define MAP_CACHE_SIGNATURE    ( 0x464D4201 ) // 'FMB' + format version
+
+bool ProtoMap::LoadCache( const string& cache_name, uint64 cache_key, EntityVec& entities )
+{
+    FileManager cache;
+    if( !cache.LoadFile( FileManager::GetWritePath( cache_name ) ) )
         return false;
+
+    UCharVec data( cache.GetBuf(), cache.GetBuf() + cache.GetFsize() );
+    uint     pos = 0;
+    uint     signature;
+    uint64   key;
+    if( !ReadDataSafe( data, pos, signature ) || signature != MAP_CACHE_SIGNATURE || !ReadDataSafe( data, pos, key ) || key != cache_key )
+        return false;
+
+    // Read to temporary storages, apply only after whole data validation
+    bool       ok = true;
+    StrVec     hash_names;
+    Properties props( Props );
+    TileVec    tiles;
+
+    uint hash_names_count;
+    ok = ReadDataSafe( data, pos, hash_names_count );
+    for( uint i = 0; ok && i < hash_names_count; i++ )
+    {
+        uint  len;
+        char* name;
+        ok = ( ReadDataSafe( data, pos, len ) && ReadDataArrSafe( data, len, pos, name ) );
+        if( ok )
+            hash_names.push_back( string( name, len ) );
+    }
+
+    ok = ( ok && props.RestoreAllData( data, pos ) );
+
+    uint entities_count;
+    ok = ( ok && ReadDataSafe( data, pos, entities_count ) );
+    for( uint i = 0; ok && i < entities_count; i++ )
+    {
+        uchar type;
+        uint  id;
+        hash  proto_id;
+        ok = ( ReadDataSafe( data, pos, type ) && ReadDataSafe( data, pos, id ) && ReadDataSafe( data, pos, proto_id ) );
+        if( !ok )
+            break;
+
+        Entity* entity = nullptr;
+        if( type == (uchar) MUTUAL_CRITTER_TYPE && ProtoMngr.GetProtoCritter( proto_id ) )
+            entity = new Npc( id, ProtoMngr.GetProtoCritter( proto_id ) );
+        else if( type == (uchar) EntityType::Item && ProtoMngr.GetProtoItem( proto_id ) )
+            entity = new Item( id, ProtoMngr.GetProtoItem( proto_id ) );
+        if( !entity )
+        {
+            ok = false;
+            break;
+        }
+
+        entities.push_back( entity );
+        ok = entity->Props.RestoreAllData( data, pos );
+    }
+
+    uint tiles_count;
+    ok = ( ok && ReadDataSafe( data, pos, tiles_count ) );
+    for( uint i = 0; ok && i < tiles_count; i++ )
+    {
+        Tile tile;
+        ok = ( ReadDataSafe( data, pos, tile.Name ) && ReadDataSafe( data, pos, tile.HexX ) && ReadDataSafe( data, pos, tile.HexY ) &&
+               ReadDataSafe( data, pos, tile.OffsX ) && ReadDataSafe( data, pos, tile.OffsY ) && ReadDataSafe( data, pos, tile.Layer ) &&
+               ReadDataSafe( data, pos, tile.IsRoof ) );
+        if( ok )
+            tiles.push_back( tile );
     }
-    else if( !is_old_format && !LoadTextFormat( data ) )
+
+    if( !ok || pos != data.size() )
     {
-        WriteLog( "Unable to load map '{}'.\n", GetName() );
+        WriteLog( "Cache of map '{}' is corrupted, parse from source.\n", GetName() );
+        for( auto& entity : entities )
+            entity->Release();
+        entities.clear();
         return false;
     }
 
+    for( const string& name : hash_names )
+        _str( name ).toHash();
+    Props = props;
+    Tiles = std::move( tiles );
     return true;
 }
 
+void ProtoMap::SaveCache( const string& cache_name, uint64 cache_key, const StrSet& hash_names, EntityVec& entities )
+{
+    UCharVec data;
+    WriteData( data, (uint) MAP_CACHE_SIGNATURE );
+    WriteData( data, cache_key );
+
+    WriteData( data, (uint) hash_names.size() );
+    for( const string& name : hash_names )
+    {
+        WriteData( data, (uint) name.length() );
+        WriteDataArr( data, name.c_str(), (uint) name.length() );
+    }
+
+    Props.StoreAllData( data );
+
+    WriteData( data, (uint) entities.size() );
+    for( auto& entity : entities )
+    {
+        WriteData( data, (uchar) entity->Type );
+        WriteData( data, entity->Id );
+        WriteData( data, entity->GetProtoId() );
+        entity->Props.StoreAllData( data );
+    }
+
+    WriteData( data, (uint) Tiles.size() );
+    for( auto& tile : Tiles )
+    {
+        WriteData( data, tile.Name );
+        WriteData( data, tile.HexX );
+        WriteData( data, tile.HexY );
+        WriteData( data, tile.OffsX );
+        WriteData( data, tile.OffsY );
+        WriteData( data, tile.Layer );
+        WriteData( data, tile.IsRoof );
+    }
+
+    FileManager cache;
+    cache.SetData( &data[ 0 ], (uint) data.size() );
+    if( !cache.SaveFile( cache_name ) )
+        WriteLog( "Unable to write cache of map '{}'.\n", GetName() );
+}
+#endif
+
 #ifdef FONLINE_MAPPER
 void ProtoMap::GenNew()
 {
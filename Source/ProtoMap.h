@@ -52,8 +52,8 @@ private:
     #ifdef FONLINE_MAPPER
     void SaveTextFormat( IniParser& file );
     #endif
-    bool LoadTextFormat( const char* buf );
-    bool LoadOldTextFormat( const char* buf );
+    bool LoadTextFormat( const char* buf, EntityVec& entities );
+    bool LoadOldTextFormat( const char* buf, EntityVec& entities );
     bool OnAfterLoad( EntityVec& entities );
 
     #ifdef FONLINE_SERVER
@@ -71,6 +71,8 @@ public:
 
 private:
     bool BindScripts( EntityVec& entities );
+    bool LoadCache( const string& cache_name, uint64 cache_key, EntityVec& entities );
+    void SaveCache( const string& cache_name, uint64 cache_key, const StrSet& hash_names, EntityVec& entities );
     #endif
 
 public:
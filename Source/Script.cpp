@@ -2,6 +2,7 @@
 #include "Script.h"
 #include "Text.h"
 #include "FileManager.h"
+#include "Crypt.h"
 #include "AngelScript/reflection.h"
 #include "AngelScript/preprocessor.h"
 #include "AngelScript/sdk/add_on/scriptstdstring/scriptstdstring.h"
@@ -576,7 +577,7 @@ bool Script::ReloadScripts( const string& target )
 
     // Build
     string result_code;
-    if( !LoadRootModule( scripts, result_code ) )
+    if( !LoadRootModule( scripts, target, result_code ) )
     {
         WriteLog( "Load scripts from files fail.\n" );
         return false;
@@ -1041,7 +1042,107 @@ void Script::CallPragmas( const Pragmas& pragmas )
         Preprocessor::CallPragma( pragmas[ i ] );
 }
 
-bool Script::LoadRootModule( const ScriptEntryVec& scripts, string& result_code )
+#ifdef FONLINE_SERVER
+# define BYTECODE_CACHE_SIGNATURE    ( 0x46424301 ) // 'FBC' + format version
+
+static uint64 GetBytecodeCacheKey( asIScriptEngine* engine, const string& code )
+{
+    // Preprocessed code, engine version and whole registered api
+    string api = _str( "{} {}\n", FONLINE_VERSION, ANGELSCRIPT_VERSION_STRING );
+    for( asUINT i = 0; i < engine->GetObjectTypeCount(); i++ )
+    {
+        asITypeInfo* type = engine->GetObjectTypeByIndex( i );
+        api += _str( "{}::{} {}\n", type->GetNamespace(), type->GetName(), type->GetFlags() );
+        for( asUINT j = 0; j < type->GetBehaviourCount(); j++ )
+            api += _str( "{}\n", type->GetBehaviourByIndex( j, nullptr )->GetDeclaration( true, true, true ) );
+        for( asUINT j = 0; j < type->GetFactoryCount(); j++ )
+            api += _str( "{}\n", type->GetFactoryByIndex( j )->GetDeclaration( true, true, true ) );
+        for( asUINT j = 0; j < type->GetMethodCount(); j++ )
+            api += _str( "{}\n", type->GetMethodByIndex( j )->GetDeclaration( true, true, true ) );
+        for( asUINT j = 0; j < type->GetPropertyCount(); j++ )
+            api += _str( "{}\n", type->GetPropertyDeclaration( j, true ) );
+    }
+    for( asUINT i = 0; i < engine->GetGlobalFunctionCount(); i++ )
+        api += _str( "{}\n", engine->GetGlobalFunctionByIndex( i )->GetDeclaration( true, true, true ) );
+    for( asUINT i = 0; i < engine->GetGlobalPropertyCount(); i++ )
+    {
+        const char* name;
+        const char* ns;
+        int         type_id;
+        bool        is_const;
+        engine->GetGlobalPropertyByIndex( i, &name, &ns, &type_id, &is_const );
+        api += _str( "{}::{} {} {}\n", ns, name, engine->GetTypeDeclaration( type_id, true ), is_const );
+    }
+    for( asUINT i = 0; i < engine->GetFuncdefCount(); i++ )
+        api += _str( "{}\n", engine->GetFuncdefByIndex( i )->GetFuncdefSignature()->GetDeclaration( true, true, true ) );
+    for( asUINT i = 0; i < engine->GetEnumCount(); i++ )
+    {
+        asITypeInfo* enum_type = engine->GetEnumByIndex( i );
+        api += _str( "{}::{}\n", enum_type->GetNamespace(), enum_type->GetName() );
+        for( asUINT j = 0; j < enum_type->GetEnumValueCount(); j++ )
+        {
+            int         value;
+            const char* value_name = enum_type->GetEnumValueByIndex( j, &value );
+            api += _str( "{} {}\n", value_name, value );
+        }
+    }
+    for( asUINT i = 0; i < engine->GetTypedefCount(); i++ )
+    {
+        asITypeInfo* type = engine->GetTypedefByIndex( i );
+        api += _str( "{}::{} {}\n", type->GetNamespace(), type->GetName(), type->GetTypedefTypeId() );
+    }
+
+    uint64 api_hash = Crypt.MurmurHash2_64( (const uchar*) api.c_str(), (uint) api.length() );
+    uint64 code_hash = Crypt.MurmurHash2_64( (const uchar*) code.c_str(), (uint) code.length() );
+    return api_hash ^ ( code_hash * 0x9E3779B97F4A7C15ULL );
+}
+
+static bool LoadBytecodeCache( asIScriptModule* module, const string& cache_name, uint64 cache_key )
+{
+    FileManager cache;
+    if( !cache.LoadFile( FileManager::GetWritePath( cache_name ) ) )
+        return false;
+    if( cache.GetFsize() < 16 || cache.GetBEUInt() != BYTECODE_CACHE_SIGNATURE )
+        return false;
+
+    uint64 key = (uint64) cache.GetBEUInt() << 32;
+    key |= cache.GetBEUInt();
+    uint   len = cache.GetBEUInt();
+    if( key != cache_key || !len || cache.GetCurPos() + len != cache.GetFsize() )
+        return false;
+
+    CBytecodeStream binary;
+    binary.Write( cache.GetCurBuf(), len );
+    int             result = module->LoadByteCode( &binary );
+    if( result < 0 )
+    {
+        WriteLog( "Can't load bytecode cache '{}', result {}.\n", cache_name, result );
+        return false;
+    }
+    return true;
+}
+
+static void SaveBytecodeCache( asIScriptModule* module, const string& cache_name, uint64 cache_key )
+{
+    CBytecodeStream binary;
+    if( module->SaveByteCode( &binary ) < 0 || binary.GetBuf().empty() )
+    {
+        WriteLog( "Unable to save bytecode of module '{}'.\n", module->GetName() );
+        return;
+    }
+
+    FileManager cache;
+    cache.SetBEUInt( BYTECODE_CACHE_SIGNATURE );
+    cache.SetBEUInt( (uint) ( cache_key >> 32 ) );
+    cache.SetBEUInt( (uint) cache_key );
+    cache.SetBEUInt( (uint) binary.GetBuf().size() );
+    cache.SetData( &binary.GetBuf()[ 0 ], (uint) binary.GetBuf().size() );
+    if( !cache.SaveFile( cache_name ) )
+        WriteLog( "Unable to write bytecode cache '{}'.\n", cache_name );
+}
+#endif
+
+bool Script::LoadRootModule( const ScriptEntryVec& scripts, const string& target, string& result_code )
 {
     RUNTIME_ASSERT( Engine->GetModuleCount() == 0 );
 
@@ -1193,6 +1294,35 @@ public:
     Preprocessor::StoreLineNumberTranslator( lnt, lnt_data );
     module->SetUserData( lnt );
 
+    // Skip build if bytecode cache matches
+    #ifdef FONLINE_SERVER
+    bool   use_cache = ( MainConfig->GetInt( "", "ScriptBytecodeCache", 1 ) != 0 );
+    string cache_name = _str( "Cache/Scripts/{}.fobc", target );
+    uint64 cache_key = 0;
+    if( use_cache )
+    {
+        cache_key = GetBytecodeCacheKey( Engine, result.String );
+        if( LoadBytecodeCache( module, cache_name, cache_key ) )
+        {
+            WriteLog( "Scripts '{}' loaded from bytecode cache.\n", target );
+            result_code = result.String;
+            return true;
+        }
+
+        // Start from clean module
+        module->SetUserData( nullptr );
+        module->Discard();
+        module = Engine->GetModule( "Root", asGM_ALWAYS_CREATE );
+        if( !module )
+        {
+            WriteLog( "Create 'Root' module fail.\n" );
+            Preprocessor::DeleteLineNumberTranslator( lnt );
+            return false;
+        }
+        module->SetUserData( lnt );
+    }
+    #endif
+
     // Add single script section
     int as_result = module->AddScriptSection( "Root", result.String.c_str() );
     if( as_result < 0 )
@@ -1211,6 +1341,11 @@ public:
         return false;
     }
 
+    #ifdef FONLINE_SERVER
+    if( use_cache )
+        SaveBytecodeCache( module, cache_name, cache_key );
+    #endif
+
     result_code = result.String;
     return true;
 }
@@ -1599,6 +1734,16 @@ string Script::GetEnumValueName( const string& enum_name, int value )
     return it_value != it->second.end() ? it_value->second : _str( "{}", value ).str();
 }
 
+uint64 Script::GetEnumValuesHash()
+{
+    // All names resolvable by GetEnumValue, script enums and content included
+    EngineData* edata = (EngineData*) Engine->GetUserData();
+    string      values;
+    for( const auto& kv : edata->CachedEnums )
+        values += _str( "{} {}\n", kv.first, kv.second );
+    return Crypt.MurmurHash2_64( (const uchar*) values.c_str(), (uint) values.length() );
+}
+
 /************************************************************************/
 /* Contexts                                                             */
 /************************************************************************/
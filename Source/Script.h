@@ -117,7 +117,7 @@ public:
     static void Define( const string& define );
     static void Undef( const string& define );
     static void CallPragmas( const Pragmas& pragmas );
-    static bool LoadRootModule( const ScriptEntryVec& scripts, string& result_code );
+    static bool LoadRootModule( const ScriptEntryVec& scripts, const string& target, string& result_code );
     static bool RestoreRootModule( const UCharVec& bytecode, const UCharVec& lnt_data );
 
     static uint               BindByFuncName( const string& func_name, const string& decl, bool is_temp, bool disable_log = false );
@@ -137,6 +137,7 @@ public:
     static int    GetEnumValue( const string& enum_value_name, bool& fail );
     static int    GetEnumValue( const string& enum_name, const string& value_name, bool& fail );
     static string GetEnumValueName( const string& enum_name, int value );
+    static uint64 GetEnumValuesHash();
 
     // Script execution
     static void              PrepareContext( uint bind_id, const string& ctx_info );
@@ -202,6 +202,8 @@ static int Bind( asIScriptEngine* engine, PropertyRegistrator** registrators )
     BIND_ASSERT( engine->RegisterObjectMethod( "Map", "const Location@+ GetLocation() const", SCRIPT_FUNC_THIS( BIND_CLASS Map_GetLocation ), SCRIPT_FUNC_THIS_CONV ) );
     BIND_ASSERT( engine->RegisterFuncdef( "void MapInitFunc(Map@+, bool)" ) );
     BIND_ASSERT( engine->RegisterObjectMethod( "Map", "bool SetScript(MapInitFunc@+ func)", SCRIPT_FUNC_THIS( BIND_CLASS Map_SetScript ), SCRIPT_FUNC_THIS_CONV ) );
+    BIND_ASSERT( engine->RegisterObjectMethod( "Map", "void WakeUp()", SCRIPT_FUNC_THIS( BIND_CLASS Map_WakeUp ), SCRIPT_FUNC_THIS_CONV ) );
+    BIND_ASSERT( engine->RegisterObjectMethod( "Map", "bool IsHibernated() const", SCRIPT_FUNC_THIS( BIND_CLASS Map_IsHibernated ), SCRIPT_FUNC_THIS_CONV ) );
     BIND_ASSERT( engine->RegisterObjectMethod( "Map", "Item@+ GetItem(uint itemId)", SCRIPT_FUNC_THIS( BIND_CLASS Map_GetItem ), SCRIPT_FUNC_THIS_CONV ) );
     BIND_ASSERT( engine->RegisterObjectMethod( "Map", "const Item@+ GetItem(uint itemId) const", SCRIPT_FUNC_THIS( BIND_CLASS Map_GetItem ), SCRIPT_FUNC_THIS_CONV ) );
     BIND_ASSERT( engine->RegisterObjectMethod( "Map", "Item@+ GetItem(uint16 hexX, uint16 hexY, hash protoId)", SCRIPT_FUNC_THIS( BIND_CLASS Map_GetItemHex ), SCRIPT_FUNC_THIS_CONV ) );
@@ -329,6 +331,7 @@ static int Bind( asIScriptEngine* engine, PropertyRegistrator** registrators )
     BIND_ASSERT( engine->RegisterGlobalFunction( "array<Critter@>@ GetAllNpc(hash pid)", SCRIPT_FUNC( BIND_CLASS Global_GetAllNpc ), SCRIPT_FUNC_CONV ) );
     BIND_ASSERT( engine->RegisterGlobalFunction( "array<Map@>@ GetAllMaps(hash pid)", SCRIPT_FUNC( BIND_CLASS Global_GetAllMaps ), SCRIPT_FUNC_CONV ) );
     BIND_ASSERT( engine->RegisterGlobalFunction( "array<Location@>@ GetAllLocations(hash pid)", SCRIPT_FUNC( BIND_CLASS Global_GetAllLocations ), SCRIPT_FUNC_CONV ) );
+    BIND_ASSERT( engine->RegisterGlobalFunction( "bool IpcSend(string channel, string data)", SCRIPT_FUNC( BIND_CLASS Global_IpcSend ), SCRIPT_FUNC_CONV ) );
     BIND_ASSERT( engine->RegisterGlobalFunction( "bool LoadImage(uint index, string imageName, uint imageDepth)", SCRIPT_FUNC( BIND_CLASS Global_LoadImage ), SCRIPT_FUNC_CONV ) );
     BIND_ASSERT( engine->RegisterGlobalFunction( "uint GetImageColor(uint index, uint x, uint y)", SCRIPT_FUNC( BIND_CLASS Global_GetImageColor ), SCRIPT_FUNC_CONV ) );
     BIND_ASSERT( engine->RegisterGlobalFunction( "void SetTime(uint16 multiplier, uint16 year, uint16 month, uint16 day, uint16 hour, uint16 minute, uint16 second)", SCRIPT_FUNC( BIND_CLASS Global_SetTime ), SCRIPT_FUNC_CONV ) );
@@ -491,8 +494,16 @@ static int Bind( asIScriptEngine* engine, PropertyRegistrator** registrators )
 
     BIND_ASSERT( engine->RegisterGlobalProperty( "const uint __FullSecond", &GameOpt.FullSecond ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __DisableTcpNagle", &GameOpt.DisableTcpNagle ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "bool __DisableUdp", &GameOpt.DisableUdp ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __UdpSimulatedLoss", &GameOpt.UdpSimulatedLoss ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __DisableZlibCompression", &GameOpt.DisableZlibCompression ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "int __ZlibCompressionLevel", &GameOpt.ZlibCompressionLevel ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __ZlibCompressionMinSize", &GameOpt.ZlibCompressionMinSize ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "bool __ZlibCompressionDictionary", &GameOpt.ZlibCompressionDictionary ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __FloodSize", &GameOpt.FloodSize ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __NetBufferHighWatermark", &GameOpt.NetBufferHighWatermark ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __NetBufferLowWatermark", &GameOpt.NetBufferLowWatermark ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __NetBufferLimit", &GameOpt.NetBufferLimit ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __NoAnswerShuffle", &GameOpt.NoAnswerShuffle ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __DialogDemandRecheck", &GameOpt.DialogDemandRecheck ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __SneakDivider", &GameOpt.SneakDivider ) );
@@ -531,6 +542,10 @@ static int Bind( asIScriptEngine* engine, PropertyRegistrator** registrators )
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __DlgTalkMinTime", &GameOpt.DlgTalkMinTime ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __DlgBarterMinTime", &GameOpt.DlgBarterMinTime ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __MinimumOfflineTime", &GameOpt.MinimumOfflineTime ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __MoveInterestNearDist", &GameOpt.MoveInterestNearDist ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __MoveInterestFarDist", &GameOpt.MoveInterestFarDist ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "uint __MapHibernationTime", &GameOpt.MapHibernationTime ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "bool __ItemVisibilityValidation", &GameOpt.ItemVisibilityValidation ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __ForceRebuildResources", &GameOpt.ForceRebuildResources ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "string __CommandLine", &GameOpt.CommandLine ) );
     #endif
@@ -721,6 +736,7 @@ static int Bind( asIScriptEngine* engine, PropertyRegistrator** registrators )
     BIND_ASSERT( engine->RegisterGlobalProperty( "string __ProxyPass", &GameOpt.ProxyPass ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __TextDelay", &GameOpt.TextDelay ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "bool __AlwaysOnTop", &GameOpt.AlwaysOnTop ) );
+    BIND_ASSERT( engine->RegisterGlobalProperty( "bool __SpriteCache", &GameOpt.SpriteCache ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "int __FixedFPS", &GameOpt.FixedFPS ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __FPS", &GameOpt.FPS ) );
     BIND_ASSERT( engine->RegisterGlobalProperty( "uint __PingPeriod", &GameOpt.PingPeriod ) );
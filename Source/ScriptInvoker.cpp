@@ -240,11 +240,11 @@ bool ScriptInvoker::LoadDeferredCalls()
 {
     WriteLog( "Load deferred calls...\n" );
 
-    UIntVec call_ids = DbStorage->GetAllIds( "DeferredCalls" );
-    int     errors = 0;
-    for( uint call_id : call_ids )
+    DataBase::Collection call_docs = DbStorage->GetAll( "DeferredCalls" );
+    int                  errors = 0;
+    for( auto& kv : call_docs )
     {
-        DataBase::Document call_doc = DbStorage->Get( "DeferredCalls", call_id );
+        DataBase::Document& call_doc = kv.second;
 
         DeferredCall       call;
         call.Id = call_doc[ "Id" ].get< int >();
@@ -1607,6 +1607,9 @@ public:
             return;
         }
 
+        // Keep order with properties changed before call
+        PropertyRegistrator::FlushDeferredSend();
+
         Client* cl = (Client*) cr;
         BufferManager& net_buf = cl->Connection->Bout;
         # else
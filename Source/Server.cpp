@@ -6,6 +6,11 @@
 #include "FileSystem.h"
 #include <chrono>
 
+extern "C"
+{
+    #include "ipc/src/ipc.h"
+}
+
 #define MAX_CLIENTS_IN_GAME    ( 3000 )
 
 int                       FOServer::UpdateIndex = -1;
@@ -14,6 +19,7 @@ uint                      FOServer::UpdateLastTick;
 ClVec                     FOServer::LogClients;
 NetServerBase*            FOServer::TcpServer;
 NetServerBase*            FOServer::WebSocketsServer;
+NetServerBase*            FOServer::UdpServer;
 ClVec                     FOServer::ConnectedClients;
 Mutex                     FOServer::ConnectedClientsLocker;
 FOServer::Statistics_     FOServer::Statistics;
@@ -30,7 +36,16 @@ Mutex                     FOServer::RegIpLocker;
 FOServer::ClientBannedVec FOServer::Banned;
 Mutex                     FOServer::BannedLocker;
 FOServer::UpdateFileVec   FOServer::UpdateFiles;
+vector< Thread* >         FOServer::LoginThreads;
+bool                      FOServer::LoginThreadsActive;
+FOServer::LoginRequestVec FOServer::LoginRequests;
+FOServer::LoginRequestVec FOServer::LoginResults;
+Mutex                     FOServer::LoginLocker;
+UIntSet                   FOServer::LoginPendingIds;
 UCharVec                  FOServer::UpdateFilesList;
+void*                     FOServer::IpcChannel;
+StrVec                    FOServer::IpcMessages;
+Mutex                     FOServer::IpcLocker;
 
 FOServer::FOServer()
 {
@@ -53,6 +68,15 @@ void FOServer::Finish()
     Active = false;
     ActiveInProcess = true;
 
+    // Send pending changes
+    PropertyRegistrator::SetDeferredSend( false );
+
+    // Drop not finished logins
+    StopLoginThreads();
+
+    // Stop receiving messages from other processes
+    StopIpcChannel();
+
     // Finish logic
     DbStorage->StartChanges();
     if( DbHistory )
@@ -84,6 +108,7 @@ void FOServer::Finish()
     // Shutdown servers
     SAFEDEL( TcpServer );
     SAFEDEL( WebSocketsServer );
+    SAFEDEL( UdpServer );
 
     // Managers
     DlgMngr.Finish();
@@ -117,19 +142,32 @@ string FOServer::GetIngamePlayersStatistics()
     ClVec players;
     CrMngr.GetClients( players );
 
-    string result = _str( "Players in game: {}\nConnections: {}\n", players.size(), conn_count );
-    result += "Name                 Id         Ip              Online  Cond     X     Y     Location and map\n";
+    uint out_buf_total = 0;
+    uint out_buf_max = 0;
+    uint congested = 0;
+    string players_str;
     for( Client* cl : players )
     {
+        uint out_buf = cl->GetOutBufLen();
+        out_buf_total += out_buf;
+        out_buf_max = MAX( out_buf_max, out_buf );
+        if( cl->IsOutBufCongested() )
+            congested++;
+
         Map*      map = MapMngr.GetMap( cl->GetMapId() );
         Location* loc = ( map ? map->GetLocation() : nullptr );
 
         string    str_loc = _str( "{} ({}) {} ({})",
                                   map ? loc->GetName() : "", map ? loc->GetId() : 0, map ? map->GetName() : "", map ? map->GetId() : 0 );
-        result += _str( "{:<20} {:<10} {:<15} {:<7} {:<8} {:<5} {:<5} {}\n",
-                        cl->Name, cl->GetId(), cl->GetIpStr(), cl->IsOffline() ? "No" : "Yes", cond_states_str[ cl->GetCond() ],
-                        map ? cl->GetHexX() : cl->GetWorldX(), map ? cl->GetHexY() : cl->GetWorldY(), map ? str_loc : "Global map" );
+        players_str += _str( "{:<20} {:<10} {:<15} {:<7} {:<8} {:<10} {:<5} {:<5} {}\n",
+                             cl->Name, cl->GetId(), cl->GetIpStr(), cl->IsOffline() ? "No" : "Yes", cond_states_str[ cl->GetCond() ],
+                             out_buf, map ? cl->GetHexX() : cl->GetWorldX(), map ? cl->GetHexY() : cl->GetWorldY(), map ? str_loc : "Global map" );
     }
+
+    string result = _str( "Players in game: {}\nConnections: {}\n", players.size(), conn_count );
+    result += _str( "Output buffers: {} bytes total, {} bytes max, {} congested\n", out_buf_total, out_buf_max, congested );
+    result += "Name                 Id         Ip              Online  Cond     OutBuf     X     Y     Location and map\n";
+    result += players_str;
     return result;
 }
 
@@ -223,6 +261,89 @@ void FOServer::MainLoop()
     WriteLog( "***   Finishing game loop  ***\n" );
 }
 
+void FOServer::CollectTrafficStatistics( NetConnection* connection )
+{
+    connection->Bout.Lock();
+    Statistics.BytesSend += connection->StatBytesSend;
+    Statistics.DataCompressed += connection->StatBytesSend;
+    Statistics.DataReal += connection->StatBytesSendReal;
+    connection->StatBytesSend = 0;
+    connection->StatBytesSendReal = 0;
+    connection->Bout.Unlock();
+
+    connection->Bin.Lock();
+    Statistics.BytesRecv += connection->StatBytesRecv;
+    connection->StatBytesRecv = 0;
+    connection->Bin.Unlock();
+}
+
+static void IpcCallback( Message* msg )
+{
+    // Called from ipc dispatch threads
+    string data( msg->data, msg->len );
+    FOServer::IpcLocker.Lock();
+    FOServer::IpcMessages.push_back( std::move( data ) );
+    FOServer::IpcLocker.Unlock();
+}
+
+void FOServer::StartIpcChannel( const string& name )
+{
+    Connection* conn = connectionCreate( (char*) name.c_str(), CONN_TYPE_ALL );
+    connectionSetCallback( conn, IpcCallback );
+    connectionStartAutoDispatch( conn );
+    IpcChannel = conn;
+    WriteLog( "Listening ipc channel '{}'.\n", name );
+}
+
+void FOServer::StopIpcChannel()
+{
+    if( !IpcChannel )
+        return;
+
+    Connection* conn = (Connection*) IpcChannel;
+    connectionStopAutoDispatch( conn );
+    connectionRemoveCallback( conn );
+    connectionClose( conn );
+    connectionDestroy( conn );
+    IpcChannel = nullptr;
+
+    SCOPE_LOCK( IpcLocker );
+    IpcMessages.clear();
+}
+
+void FOServer::ProcessIpcMessages()
+{
+    if( !IpcChannel )
+        return;
+
+    StrVec messages;
+    IpcLocker.Lock();
+    messages.swap( IpcMessages );
+    IpcLocker.Unlock();
+
+    for( string& data : messages )
+        Script::RaiseInternalEvent( ServerFunctions.IpcMessage, &data );
+}
+
+bool FOServer::SendIpcMessage( const string& channel, const string& data )
+{
+    if( channel.empty() || channel.find_first_of( "/\\" ) != string::npos || data.length() >= MAX_MSG_SIZE )
+        return false;
+
+    // Only channels opened by a running listener
+    #ifndef FO_WINDOWS
+    if( !FileExist( "/tmp/" + channel ) )
+        return false;
+    #endif
+
+    Connection* conn = connectionConnect( (char*) channel.c_str(), CONN_TYPE_ALL );
+    Message*    msg = messageCreate( (char*) data.c_str(), data.length() );
+    connectionSend( conn, msg );
+    messageDestroy( msg );
+    connectionDestroy( conn );
+    return true;
+}
+
 void FOServer::LogicTick()
 {
     Timer::UpdateTick();
@@ -244,6 +365,9 @@ void FOServer::LogicTick()
 
     for( Client* cl : clients )
     {
+        // Traffic statistics
+        CollectTrafficStatistics( cl->Connection );
+
         // Check for removing
         if( cl->IsOffline() )
         {
@@ -265,6 +389,10 @@ void FOServer::LogicTick()
         cl->Release();
     }
 
+    // Authenticated players
+    ProcessLogIns();
+    Statistics.CompressRatio = (float) ( (double) Statistics.DataReal / (double) Statistics.DataCompressed );
+
     // Process critters
     CrVec critters;
     EntityMngr.GetCritters( critters );
@@ -278,6 +406,17 @@ void FOServer::LogicTick()
         if( cr->IsDestroyed )
             continue;
 
+        // Npc on hibernated map
+        if( GameOpt.MapHibernationTime && cr->IsNpc() && cr->GetMapId() )
+        {
+            Map* map = MapMngr.GetMap( cr->GetMapId() );
+            if( map && map->IsHibernated() )
+            {
+                ProcessCritterTimeEvents( cr );
+                continue;
+            }
+        }
+
         // Process logic
         ProcessCritter( cr );
     }
@@ -304,6 +443,9 @@ void FOServer::LogicTick()
     // Bans
     ProcessBans();
 
+    // Messages from other server processes
+    ProcessIpcMessages();
+
     // Process pending invocations
     Script::ProcessDeferredCalls();
 
@@ -313,6 +455,9 @@ void FOServer::LogicTick()
     // Suspended contexts
     Script::RunSuspended();
 
+    // Send properties changed during this tick
+    PropertyRegistrator::FlushDeferredSend();
+
     // Commit changed to data base
     DbStorage->CommitChanges();
     if( DbHistory )
@@ -463,6 +608,15 @@ void FOServer::Process( Client* cl )
             cl->Disconnect();
         }
     }
+    else if( cl->GameState == STATE_AUTHENTICATING )
+    {
+        // Login threads result handled in ProcessLogIns, drop client if storage hangs
+        if( cl->LastActivityTime && Timer::FastTick() - cl->LastActivityTime > PING_CLIENT_LIFE_TIME )
+        {
+            WriteLog( "Authentication timeout, client kicked. Ip '{}'.\n", cl->GetIpStr() );
+            cl->Disconnect();
+        }
+    }
     else if( cl->GameState == STATE_TRANSFERRING )
     {
         #define CHECK_BUSY                                                                                        \
@@ -1907,6 +2061,7 @@ bool FOServer::InitReal()
     Statistics.BytesRecv = 0;
     Statistics.DataReal = 1;
     Statistics.DataCompressed = 1;
+    Statistics.CompressRatio = 1.0f;
     Statistics.ServerStartTick = Timer::FastTick();
 
     // Net
@@ -1917,10 +2072,26 @@ bool FOServer::InitReal()
         return false;
     if( !( WebSocketsServer = NetServerBase::StartWebSocketsServer( port + 1, FOServer::OnNewConnection ) ) )
         return false;
+    if( MainConfig->GetInt( "", "UdpChannel", 0 ) != 0 )
+        UdpServer = NetServerBase::StartUdpServer( port );
+
+    // Login workers, 0 - process logins in logic thread
+    StartLoginThreads( MainConfig->GetInt( "", "LoginThreads", 2 ) );
 
     // Script timeouts
     Script::SetRunTimeout( GameOpt.ScriptRunSuspendTimeout, GameOpt.ScriptRunMessageTimeout );
 
+    // Collect property changes and send them once per tick
+    PropertyRegistrator::SetDeferredSend( MainConfig->GetInt( "", "DeferredPropertySend", 1 ) != 0 );
+
+    // Suspend npc processing on maps without players, 0 - disabled
+    GameOpt.MapHibernationTime = MainConfig->GetInt( "", "MapHibernationTime", GameOpt.MapHibernationTime );
+
+    // Script messages from other server processes, empty - disabled
+    string ipc_channel = MainConfig->GetStr( "", "IpcChannel" );
+    if( !ipc_channel.empty() )
+        StartIpcChannel( ipc_channel );
+
     Active = true;
     return true;
 }
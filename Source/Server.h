@@ -105,6 +105,7 @@ public:
     static void OnSendCritterValue( Entity* entity, Property* prop );
     static void OnSendMapValue( Entity* entity, Property* prop );
     static void OnSendLocationValue( Entity* entity, Property* prop );
+    static void OnSetLocationZone( Entity* entity, Property* prop, void* cur_value, void* old_value );
 
     // Items
     static Item* CreateItemOnHex( Map* map, ushort hx, ushort hy, hash pid, uint count, Properties* props, bool check_blocks );
@@ -115,10 +116,12 @@ public:
     static void  OnSetItemBlockLines( Entity* entity, Property* prop, void* cur_value, void* old_value );
     static void  OnSetItemIsGeck( Entity* entity, Property* prop, void* cur_value, void* old_value );
     static void  OnSetItemIsRadio( Entity* entity, Property* prop, void* cur_value, void* old_value );
+    static void  OnSetItemRadioListener( Entity* entity, Property* prop, void* cur_value, void* old_value );
     static void  OnSetItemOpened( Entity* entity, Property* prop, void* cur_value, void* old_value );
 
     // Npc
     static void ProcessCritter( Critter* cr );
+    static void ProcessCritterTimeEvents( Critter* cr );
     static bool Dialog_Compile( Npc* npc, Client* cl, const Dialog& base_dlg, Dialog& compiled_dlg );
     static bool Dialog_CheckDemand( Npc* npc, Client* cl, DialogAnswer& answer, bool recheck );
     static uint Dialog_UseResult( Npc* npc, Client* cl, DialogAnswer& answer );
@@ -136,6 +139,44 @@ public:
     static void Process( Client* cl );
     static void ProcessMove( Critter* cr );
 
+    // Login, authentication and player data reading in worker threads
+    struct LoginRequest
+    {
+        Client*                        Cl;
+        uint                           Id;
+        uint                           Ip;
+        string                         Name;
+        string                         Password;
+        bool                           WasInGame;
+        bool                           Success;
+        vector< pair< uint, string > > FailMessages;
+        DataBase::Document             Doc;
+    };
+    typedef vector< LoginRequest* > LoginRequestVec;
+    static vector< Thread* > LoginThreads;
+    static bool              LoginThreadsActive;
+    static LoginRequestVec   LoginRequests;
+    static LoginRequestVec   LoginResults;
+    static Mutex             LoginLocker;
+    static UIntSet           LoginPendingIds;
+
+    static void StartLoginThreads( uint count );
+    static void StopLoginThreads();
+    static void LoginThread( void* );
+    static void AuthenticateLogIn( LoginRequest* request );
+    static void ProcessLogIns();
+    static void Process_LogInFinish( Client*& cl, LoginRequest* request );
+
+    // Script messages between server processes on the same host
+    static void*     IpcChannel;
+    static StrVec    IpcMessages;
+    static Mutex     IpcLocker;
+
+    static void StartIpcChannel( const string& name );
+    static void StopIpcChannel();
+    static void ProcessIpcMessages();
+    static bool SendIpcMessage( const string& channel, const string& data );
+
     // Log to client
     static ClVec LogClients;
     static void LogToClients( const string& str );
@@ -165,6 +206,7 @@ public:
     // Net
     static NetServerBase* TcpServer;
     static NetServerBase* WebSocketsServer;
+    static NetServerBase* UdpServer;
     static ClVec          ConnectedClients;
     static Mutex          ConnectedClientsLocker;
 
@@ -228,6 +270,7 @@ public:
     } static Statistics;
 
     static string GetIngamePlayersStatistics();
+    static void   CollectTrafficStatistics( NetConnection* connection );
 
     // Script functions
     struct SScriptFunc
@@ -315,6 +358,8 @@ public:
 
         static Location*     Map_GetLocation( Map* map );
         static bool          Map_SetScript( Map* map, asIScriptFunction* func );
+        static void          Map_WakeUp( Map* map );
+        static bool          Map_IsHibernated( Map* map );
         static Item*         Map_AddItem( Map* map, ushort hx, ushort hy, hash proto_id, uint count, CScriptDict* props );
         static CScriptArray* Map_GetItems( Map* map );
         static CScriptArray* Map_GetItemsHex( Map* map, ushort hx, ushort hy );
@@ -417,6 +462,7 @@ public:
         static CScriptArray* Global_GetAllNpc( hash pid );
         static CScriptArray* Global_GetAllMaps( hash pid );
         static CScriptArray* Global_GetAllLocations( hash pid );
+        static bool          Global_IpcSend( string channel, string data );
         static void          Global_GetTime( ushort& year, ushort& month, ushort& day, ushort& day_of_week, ushort& hour, ushort& minute, ushort& second, ushort& milliseconds );
         static void          Global_SetPropertyGetCallback( asIScriptGeneric* gen );
         static void          Global_AddPropertySetCallback( asIScriptGeneric* gen );
@@ -10,6 +10,7 @@ void FOServer::ProcessCritter( Critter* cr )
 
     // Moving
     ProcessMove( cr );
+    cr->ProcessMoveInterest();
 
     // Idle functions
     Script::RaiseInternalEvent( ServerFunctions.CritterIdle, cr );
@@ -17,40 +18,7 @@ void FOServer::ProcessCritter( Critter* cr )
         Script::RaiseInternalEvent( ServerFunctions.CritterGlobalMapIdle, cr );
 
     // Internal misc/drugs time events
-    // One event per cycle
-    if( cr->IsNonEmptyTE_FuncNum() )
-    {
-        CScriptArray* te_next_time = cr->GetTE_NextTime();
-        uint          next_time = *(uint*) te_next_time->At( 0 );
-        if( !next_time || GameOpt.FullSecond >= next_time )
-        {
-            CScriptArray* te_func_num = cr->GetTE_FuncNum();
-            CScriptArray* te_rate = cr->GetTE_Rate();
-            CScriptArray* te_identifier = cr->GetTE_Identifier();
-            RUNTIME_ASSERT( te_next_time->GetSize() == te_func_num->GetSize() );
-            RUNTIME_ASSERT( te_func_num->GetSize() == te_rate->GetSize() );
-            RUNTIME_ASSERT( te_rate->GetSize() == te_identifier->GetSize() );
-            hash func_num = *(hash*) te_func_num->At( 0 );
-            uint rate = *(hash*) te_rate->At( 0 );
-            int  identifier = *(hash*) te_identifier->At( 0 );
-            te_func_num->Release();
-            te_rate->Release();
-            te_identifier->Release();
-
-            cr->EraseCrTimeEvent( 0 );
-
-            uint time = Globals->GetTimeMultiplier() * 1800;             // 30 minutes on error
-            Script::PrepareScriptFuncContext( func_num, cr->GetName() );
-            Script::SetArgEntity( cr );
-            Script::SetArgUInt( identifier );
-            Script::SetArgAddress( &rate );
-            if( Script::RunPrepared() )
-                time = Script::GetReturnedUInt();
-            if( time )
-                cr->AddCrTimeEvent( func_num, rate, time, identifier );
-        }
-        te_next_time->Release();
-    }
+    ProcessCritterTimeEvents( cr );
 
     // Client
     if( cr->IsPlayer() )
@@ -65,6 +33,9 @@ void FOServer::ProcessCritter( Critter* cr )
         if( cl->IsToPing() )
             cl->PingClient();
 
+        // Output buffer backpressure
+        cl->ProcessOutBuf();
+
         // Kick from game
         if( cl->IsOffline() && cl->IsLife() && !IS_TIMEOUT( cl->GetTimeoutBattle() ) &&
             !cl->GetTimeoutRemoveFromGame() && cl->GetOfflineTime() >= GameOpt.MinimumOfflineTime )
@@ -82,6 +53,47 @@ void FOServer::ProcessCritter( Critter* cr )
     }
 }
 
+void FOServer::ProcessCritterTimeEvents( Critter* cr )
+{
+    if( cr->CanBeRemoved || cr->IsDestroyed || Timer::IsGamePaused() )
+        return;
+
+    // One event per cycle
+    if( !cr->IsNonEmptyTE_FuncNum() )
+        return;
+
+    CScriptArray* te_next_time = cr->GetTE_NextTime();
+    uint          next_time = *(uint*) te_next_time->At( 0 );
+    if( !next_time || GameOpt.FullSecond >= next_time )
+    {
+        CScriptArray* te_func_num = cr->GetTE_FuncNum();
+        CScriptArray* te_rate = cr->GetTE_Rate();
+        CScriptArray* te_identifier = cr->GetTE_Identifier();
+        RUNTIME_ASSERT( te_next_time->GetSize() == te_func_num->GetSize() );
+        RUNTIME_ASSERT( te_func_num->GetSize() == te_rate->GetSize() );
+        RUNTIME_ASSERT( te_rate->GetSize() == te_identifier->GetSize() );
+        hash func_num = *(hash*) te_func_num->At( 0 );
+        uint rate = *(hash*) te_rate->At( 0 );
+        int  identifier = *(hash*) te_identifier->At( 0 );
+        te_func_num->Release();
+        te_rate->Release();
+        te_identifier->Release();
+
+        cr->EraseCrTimeEvent( 0 );
+
+        uint time = Globals->GetTimeMultiplier() * 1800;             // 30 minutes on error
+        Script::PrepareScriptFuncContext( func_num, cr->GetName() );
+        Script::SetArgEntity( cr );
+        Script::SetArgUInt( identifier );
+        Script::SetArgAddress( &rate );
+        if( Script::RunPrepared() )
+            time = Script::GetReturnedUInt();
+        if( time )
+            cr->AddCrTimeEvent( func_num, rate, time, identifier );
+    }
+    te_next_time->Release();
+}
+
 bool FOServer::Act_Move( Critter* cr, ushort hx, ushort hy, uint move_params )
 {
     uint map_id = cr->GetMapId();
@@ -148,7 +160,7 @@ bool FOServer::Act_Move( Critter* cr, ushort hx, ushort hy, uint move_params )
 
     cr->SendA_Move( move_params );
     cr->ProcessVisibleCritters();
-    cr->ProcessVisibleItems();
+    cr->ProcessVisibleItemsStep( fx, fy );
 
     // Triggers
     if( cr->GetMapId() == map->GetId() )
@@ -505,6 +517,7 @@ void FOServer::Process_LogIn( Client*& cl )
     cl->Name = name;
     char password[ UTF8_BUF_SIZE( MAX_NAME ) ];
     cl->Connection->Bin.Pop( password, sizeof( password ) );
+    password[ sizeof( password ) - 1 ] = 0;
 
     // Bin hashes
     uint msg_language;
@@ -526,46 +539,151 @@ void FOServer::Process_LogIn( Client*& cl )
         return;
     }
 
+    // Authentication request
+    LoginRequest* request = new LoginRequest();
+    request->Cl = cl;
+    request->Id = MAKE_CLIENT_ID( cl->Name );
+    request->Ip = cl->GetIp();
+    request->Name = cl->Name;
+    request->Password = password;
+    request->WasInGame = false;
+    request->Success = false;
+
+    // Process immediately
+    if( LoginThreads.empty() )
+    {
+        AuthenticateLogIn( request );
+        Process_LogInFinish( cl, request );
+        delete request;
+        return;
+    }
+
+    // Only one request per player at once
+    if( LoginPendingIds.count( request->Id ) )
+    {
+        cl->Send_TextMsg( cl, STR_NET_PLAYER_IN_GAME, SAY_NETMSG, TEXTMSG_GAME );
+        cl->Disconnect();
+        delete request;
+        return;
+    }
+
+    // Pass to login threads, result handled in ProcessLogIns
+    request->WasInGame = ( CrMngr.GetPlayer( request->Id ) != nullptr );
+    LoginPendingIds.insert( request->Id );
+    cl->AddRef();
+    cl->GameState = STATE_AUTHENTICATING;
+
+    SCOPE_LOCK( LoginLocker );
+    LoginRequests.push_back( request );
+}
+
+void FOServer::StartLoginThreads( uint count )
+{
+    LoginThreadsActive = true;
+    for( uint i = 0; i < count; i++ )
+    {
+        LoginThreads.push_back( new Thread() );
+        LoginThreads.back()->Start( LoginThread, _str( "Login{}", i ) );
+    }
+}
+
+void FOServer::StopLoginThreads()
+{
+    LoginLocker.Lock();
+    LoginThreadsActive = false;
+    LoginLocker.Unlock();
+
+    for( Thread* thread : LoginThreads )
+    {
+        thread->Wait();
+        delete thread;
+    }
+    LoginThreads.clear();
+
+    for( LoginRequest* request : LoginRequests )
+    {
+        request->Cl->Release();
+        delete request;
+    }
+    LoginRequests.clear();
+    for( LoginRequest* request : LoginResults )
+    {
+        request->Cl->Release();
+        delete request;
+    }
+    LoginResults.clear();
+    LoginPendingIds.clear();
+}
+
+void FOServer::LoginThread( void* )
+{
+    while( true )
+    {
+        LoginLocker.Lock();
+        if( !LoginThreadsActive )
+        {
+            LoginLocker.Unlock();
+            break;
+        }
+        LoginRequest* request = nullptr;
+        if( !LoginRequests.empty() )
+        {
+            request = LoginRequests.front();
+            LoginRequests.erase( LoginRequests.begin() );
+        }
+        LoginLocker.Unlock();
+
+        if( !request )
+        {
+            Thread_Sleep( 1 );
+            continue;
+        }
+
+        AuthenticateLogIn( request );
+
+        SCOPE_LOCK( LoginLocker );
+        LoginResults.push_back( request );
+    }
+}
+
+void FOServer::AuthenticateLogIn( LoginRequest* request )
+{
+    // Called from login threads, must not touch game entities
+
     // Check for ban by ip
     {
         SCOPE_LOCK( BannedLocker );
 
-        uint          ip = cl->GetIp();
-        ClientBanned* ban = GetBanByIp( ip );
+        ClientBanned* ban = GetBanByIp( request->Ip );
         if( ban )
         {
-            cl->Send_TextMsg( cl, STR_NET_BANNED_IP, SAY_NETMSG, TEXTMSG_GAME );
-            if( _str( ban->ClientName ).compareIgnoreCaseUtf8( cl->Name ) )
-                cl->Send_TextMsgLex( cl, STR_NET_BAN_REASON, SAY_NETMSG, TEXTMSG_GAME, ban->GetBanLexems().c_str() );
-            cl->Send_TextMsgLex( cl, STR_NET_TIME_LEFT, SAY_NETMSG, TEXTMSG_GAME, _str( "$time{}", GetBanTime( *ban ) ).c_str() );
-            cl->Disconnect();
+            request->FailMessages.push_back( std::make_pair( STR_NET_BANNED_IP, string() ) );
+            if( _str( ban->ClientName ).compareIgnoreCaseUtf8( request->Name ) )
+                request->FailMessages.push_back( std::make_pair( STR_NET_BAN_REASON, ban->GetBanLexems() ) );
+            request->FailMessages.push_back( std::make_pair( STR_NET_TIME_LEFT, _str( "$time{}", GetBanTime( *ban ) ).str() ) );
             return;
         }
     }
 
     // Check login/password
-    uint name_len_utf8 = _str( cl->Name ).lengthUtf8();
+    uint name_len_utf8 = _str( request->Name ).lengthUtf8();
     if( name_len_utf8 < MIN_NAME || name_len_utf8 < GameOpt.MinNameLength || name_len_utf8 > MAX_NAME || name_len_utf8 > GameOpt.MaxNameLength )
     {
-        cl->Send_TextMsg( cl, STR_NET_WRONG_LOGIN, SAY_NETMSG, TEXTMSG_GAME );
-        cl->Disconnect();
+        request->FailMessages.push_back( std::make_pair( STR_NET_WRONG_LOGIN, string() ) );
         return;
     }
 
-    if( !_str( cl->Name ).isValidUtf8() || cl->Name.find( '*' ) != string::npos )
+    if( !_str( request->Name ).isValidUtf8() || request->Name.find( '*' ) != string::npos )
     {
-        cl->Send_TextMsg( cl, STR_NET_WRONG_DATA, SAY_NETMSG, TEXTMSG_GAME );
-        cl->Disconnect();
+        request->FailMessages.push_back( std::make_pair( STR_NET_WRONG_DATA, string() ) );
         return;
     }
 
     // Check password
-    uint               id = MAKE_CLIENT_ID( cl->Name );
-    DataBase::Document doc = DbStorage->Get( "Players", id );
-    if( !doc.count( "Password" ) || doc[ "Password" ].which() != DataBase::StringValue || !Str::Compare( password, doc[ "Password" ].get< string >().c_str() ) )
+    DataBase::Document doc = DbStorage->Get( "Players", request->Id );
+    if( !doc.count( "Password" ) || doc[ "Password" ].which() != DataBase::StringValue || !Str::Compare( request->Password.c_str(), doc[ "Password" ].get< string >().c_str() ) )
     {
-        cl->Send_TextMsg( cl, STR_NET_LOGINPASS_WRONG, SAY_NETMSG, TEXTMSG_GAME );
-        cl->Disconnect();
+        request->FailMessages.push_back( std::make_pair( STR_NET_LOGINPASS_WRONG, string() ) );
         return;
     }
 
@@ -573,17 +691,67 @@ void FOServer::Process_LogIn( Client*& cl )
     {
         SCOPE_LOCK( BannedLocker );
 
-        ClientBanned* ban = GetBanByName( cl->Name.c_str() );
+        ClientBanned* ban = GetBanByName( request->Name.c_str() );
         if( ban )
         {
-            cl->Send_TextMsg( cl, STR_NET_BANNED, SAY_NETMSG, TEXTMSG_GAME );
-            cl->Send_TextMsgLex( cl, STR_NET_BAN_REASON, SAY_NETMSG, TEXTMSG_GAME, ban->GetBanLexems().c_str() );
-            cl->Send_TextMsgLex( cl, STR_NET_TIME_LEFT, SAY_NETMSG, TEXTMSG_GAME, _str( "$time{}", GetBanTime( *ban ) ).c_str() );
-            cl->Disconnect();
+            request->FailMessages.push_back( std::make_pair( STR_NET_BANNED, string() ) );
+            request->FailMessages.push_back( std::make_pair( STR_NET_BAN_REASON, ban->GetBanLexems() ) );
+            request->FailMessages.push_back( std::make_pair( STR_NET_TIME_LEFT, _str( "$time{}", GetBanTime( *ban ) ).str() ) );
             return;
         }
     }
 
+    request->Doc = std::move( doc );
+    request->Success = true;
+}
+
+void FOServer::ProcessLogIns()
+{
+    if( LoginThreads.empty() )
+        return;
+
+    LoginRequestVec results;
+    LoginLocker.Lock();
+    results.swap( LoginResults );
+    LoginLocker.Unlock();
+
+    for( LoginRequest* request : results )
+    {
+        LoginPendingIds.erase( request->Id );
+
+        // Connection may be closed while authenticating
+        Client* cl = request->Cl;
+        if( !cl->IsOffline() && !cl->IsDestroyed )
+        {
+            BIN_BEGIN( cl );
+            cl->GameState = STATE_CONNECTED;
+            Process_LogInFinish( cl, request );
+            BIN_END( cl );
+        }
+
+        request->Cl->Release();
+        delete request;
+    }
+}
+
+void FOServer::Process_LogInFinish( Client*& cl, LoginRequest* request )
+{
+    if( !request->Success )
+    {
+        for( auto& msg : request->FailMessages )
+        {
+            if( !msg.second.empty() )
+                cl->Send_TextMsgLex( cl, msg.first, SAY_NETMSG, TEXTMSG_GAME, msg.second.c_str() );
+            else
+                cl->Send_TextMsg( cl, msg.first, SAY_NETMSG, TEXTMSG_GAME );
+        }
+        cl->Disconnect();
+        return;
+    }
+
+    uint                id = request->Id;
+    DataBase::Document& doc = request->Doc;
+
     // Request script
     uint   disallow_msg_num = 0, disallow_str_num = 0;
     string lexems;
@@ -642,6 +810,10 @@ void FOServer::Process_LogIn( Client*& cl )
     {
         cl->SetId( id );
 
+        // Player data changed in game after reading
+        if( request->WasInGame )
+            doc = DbStorage->Get( "Players", id );
+
         // Data
         if( !cl->Props.LoadFromDbDocument( doc ) )
         {
@@ -722,9 +894,10 @@ void FOServer::Process_LogIn( Client*& cl )
     SAFEREL( conn_port );
 
     // Login ok
-    uint       msg_len = sizeof( uint ) + sizeof( msg_len ) + sizeof( uint ) * 2;
+    uint       msg_len = sizeof( uint ) + sizeof( msg_len ) + sizeof( uint ) * 3;
     uint       bin_seed = Random( 100000, 2000000000 );
     uint       bout_seed = Random( 100000, 2000000000 );
+    uint       udp_session = ( UdpServer ? cl->Connection->EnableUdp() : 0 );
     PUCharVec* global_vars_data;
     UIntVec*   global_vars_data_sizes;
     uint       whole_data_size = Globals->Props.StoreData( false, &global_vars_data, &global_vars_data_sizes );
@@ -734,6 +907,7 @@ void FOServer::Process_LogIn( Client*& cl )
     cl->Connection->Bout << msg_len;
     cl->Connection->Bout << bin_seed;
     cl->Connection->Bout << bout_seed;
+    cl->Connection->Bout << udp_session;
     NET_WRITE_PROPERTIES( cl->Connection->Bout, global_vars_data, global_vars_data_sizes );
     BOUT_END( cl );
 
@@ -1244,3 +1418,11 @@ void FOServer::OnSendLocationValue( Entity* entity, Property* prop )
             map->SendProperty( NetProperty::Location, prop, loc );
     }
 }
+
+void FOServer::OnSetLocationZone( Entity* entity, Property* prop, void* cur_value, void* old_value )
+{
+    // WorldX, WorldY, Radius
+    Location* loc = (Location*) entity;
+    if( loc->ZoneIndexed )
+        MapMngr.IndexLocationZones( loc, true );
+}
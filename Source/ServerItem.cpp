@@ -169,6 +169,15 @@ void FOServer::OnSetItemIsRadio( Entity* entity, Property* prop, void* cur_value
     ItemMngr.RadioRegister( item, value );
 }
 
+void FOServer::OnSetItemRadioListener( Entity* entity, Property* prop, void* cur_value, void* old_value )
+{
+    Item* item = (Item*) entity;
+
+    // Move to actual channel and receive scope
+    if( item->GetIsRadio() && !item->IsDestroyed )
+        ItemMngr.RadioRegister( item, true );
+}
+
 void FOServer::OnSetItemOpened( Entity* entity, Property* prop, void* cur_value, void* old_value )
 {
     Item* item = (Item*) entity;
@@ -194,6 +194,7 @@ bool FOServer::InitScriptSystem()
     BIND_INTERNAL_EVENT( ItemWalk );
     BIND_INTERNAL_EVENT( ItemCheckMove );
     BIND_INTERNAL_EVENT( StaticItemWalk );
+    BIND_INTERNAL_EVENT( IpcMessage );
     #undef BIND_INTERNAL_EVENT
 
     ASDbgMemoryCanWork = true;
@@ -217,11 +218,17 @@ bool FOServer::InitScriptSystem()
     Item::PropertiesRegistrator->SetNativeSetCallback( "BlockLines", OnSetItemBlockLines );
     Item::PropertiesRegistrator->SetNativeSetCallback( "IsGeck", OnSetItemIsGeck );
     Item::PropertiesRegistrator->SetNativeSetCallback( "IsRadio", OnSetItemIsRadio );
+    Item::PropertiesRegistrator->SetNativeSetCallback( "RadioChannel", OnSetItemRadioListener );
+    Item::PropertiesRegistrator->SetNativeSetCallback( "RadioFlags", OnSetItemRadioListener );
+    Item::PropertiesRegistrator->SetNativeSetCallback( "RadioBroadcastRecv", OnSetItemRadioListener );
     Item::PropertiesRegistrator->SetNativeSetCallback( "Opened", OnSetItemOpened );
     Map::SetPropertyRegistrator( registrators[ 3 ] );
     Map::PropertiesRegistrator->SetNativeSendCallback( OnSendMapValue );
     Location::SetPropertyRegistrator( registrators[ 4 ] );
     Location::PropertiesRegistrator->SetNativeSendCallback( OnSendLocationValue );
+    Location::PropertiesRegistrator->SetNativeSetCallback( "WorldX", OnSetLocationZone );
+    Location::PropertiesRegistrator->SetNativeSetCallback( "WorldY", OnSetLocationZone );
+    Location::PropertiesRegistrator->SetNativeSetCallback( "Radius", OnSetLocationZone );
 
     WriteLog( "Script system initialization complete.\n" );
     return true;
@@ -1856,6 +1863,22 @@ Location* FOServer::SScriptFunc::Map_GetLocation( Map* map )
     return map->GetLocation();
 }
 
+void FOServer::SScriptFunc::Map_WakeUp( Map* map )
+{
+    if( map->IsDestroyed )
+        SCRIPT_ERROR_R( "Attempt to call method on destroyed object." );
+
+    map->WakeUp();
+}
+
+bool FOServer::SScriptFunc::Map_IsHibernated( Map* map )
+{
+    if( map->IsDestroyed )
+        SCRIPT_ERROR_R0( "Attempt to call method on destroyed object." );
+
+    return map->IsHibernated();
+}
+
 bool FOServer::SScriptFunc::Map_SetScript( Map* map, asIScriptFunction* func )
 {
     if( map->IsDestroyed )
@@ -2643,8 +2666,13 @@ Map* FOServer::SScriptFunc::Location_GetMap( Location* loc, hash map_pid )
         SCRIPT_ERROR_R0( "Attempt to call method on destroyed object." );
 
     for( Map* map : loc->GetMaps() )
+    {
         if( map->GetProtoId() == map_pid )
+        {
+            map->WakeUp();
             return map;
+        }
+    }
     return nullptr;
 }
 
@@ -2657,6 +2685,7 @@ Map* FOServer::SScriptFunc::Location_GetMapByIndex( Location* loc, uint index )
     if( index >= maps.size() )
         SCRIPT_ERROR_R0( "Invalid index arg." );
 
+    maps[ index ]->WakeUp();
     return maps[ index ];
 }
 
@@ -3082,7 +3111,11 @@ Map* FOServer::SScriptFunc::Global_GetMap( uint map_id )
     if( !map_id )
         SCRIPT_ERROR_R0( "Map id arg is zero." );
 
-    return MapMngr.GetMap( map_id );
+    // Map looked up by script is going to be used, wake it up
+    Map* map = MapMngr.GetMap( map_id );
+    if( map )
+        map->WakeUp();
+    return map;
 }
 
 Map* FOServer::SScriptFunc::Global_GetMapByPid( hash map_pid, uint skip_count )
@@ -3090,7 +3123,10 @@ Map* FOServer::SScriptFunc::Global_GetMapByPid( hash map_pid, uint skip_count )
     if( !map_pid )
         SCRIPT_ERROR_R0( "Invalid zero map proto id arg." );
 
-    return MapMngr.GetMapByPid( map_pid, skip_count );
+    Map* map = MapMngr.GetMapByPid( map_pid, skip_count );
+    if( map )
+        map->WakeUp();
+    return map;
 }
 
 Location* FOServer::SScriptFunc::Global_GetLocation( uint loc_id )
@@ -3432,6 +3468,11 @@ CScriptArray* FOServer::SScriptFunc::Global_GetRegisteredPlayerIds()
     return result;
 }
 
+bool FOServer::SScriptFunc::Global_IpcSend( string channel, string data )
+{
+    return SendIpcMessage( channel, data );
+}
+
 CScriptArray* FOServer::SScriptFunc::Global_GetAllNpc( hash pid )
 {
     CrVec npcs;
@@ -15,9 +15,27 @@ SoundManager SndMngr;
 #include "vorbis/codec.h"
 #include "vorbis/vorbisfile.h"
 
+#define SOUNDS_CACHE_MAX_SIZE    ( 16 * 1024 * 1024 )
+
 static SDL_AudioDeviceID DeviceID = 0;
 static SDL_AudioSpec     SoundSpec;
 
+// Converted data of short sounds, shared between playing sounds
+struct SoundData
+{
+    uchar* Buf;
+    uint   Size;
+    uint   RefCount;
+    uint   LastUse;
+
+    SoundData(): Buf( nullptr ), Size( 0 ), RefCount( 0 ), LastUse( 0 ) {}
+    ~SoundData() { SAFEDELA( Buf ); }
+};
+typedef map< string, SoundData* > SoundDataMap;
+
+static SoundDataMap SoundsCache;
+static uint         SoundsCacheSize = 0;
+
 // Sound structure
 class Sound
 {
@@ -41,17 +59,34 @@ public:
     uint            RepeatTime;
 
     OggVorbis_File* OggStream;
+    SoundData*      Shared;
+    bool            IsFinished;
+
+    // Stream part decoded ahead in main thread, guarded by lock
+    SDL_SpinLock    StreamLock;
+    uchar*          NextBuf;
+    uint            NextBufRealSize;
+    uint            NextBufSize;
+    bool            NextReady;
+    bool            StreamEnded;
 
     Sound(): BaseBuf( nullptr ), BaseBufSize( 0 ), CvtBuilded( false ), ConvertedBuf( nullptr ),
              ConvertedBufRealSize( 0 ), ConvertedBufSize( 0 ), ConvertedBufCur( 0 ),
              OriginalFormat( 0 ), OriginalChannels( 0 ), OriginalRate( 0 ),
              IsMusic( false ), NextPlay( 0 ), RepeatTime( 0 ),
-             OggStream( nullptr )
+             OggStream( nullptr ), Shared( nullptr ), IsFinished( false ),
+             StreamLock( 0 ), NextBuf( nullptr ), NextBufRealSize( 0 ), NextBufSize( 0 ), NextReady( false ), StreamEnded( false )
     {}
     ~Sound()
     {
+        if( Shared )
+        {
+            Shared->RefCount--;
+            ConvertedBuf = nullptr;
+        }
         SAFEDELA( BaseBuf );
         SAFEDELA( ConvertedBuf );
+        SAFEDELA( NextBuf );
         if( OggStream )
             ov_clear( OggStream );
         SAFEDEL( OggStream );
@@ -106,6 +141,7 @@ bool SoundManager::Init()
     }
 
     outputBuf.resize( SoundSpec.size );
+    mixBuf.resize( SoundSpec.size / ( SDL_AUDIO_BITSIZE( SoundSpec.format ) / 8 ) );
 
     // Start playing
     SDL_PauseAudioDevice( DeviceID, 0 );
@@ -121,6 +157,7 @@ void SoundManager::Finish()
 
     StopSounds();
     StopMusic();
+    ClearCache();
 
     SDL_CloseAudioDevice( DeviceID );
     DeviceID = 0;
@@ -129,25 +166,98 @@ void SoundManager::Finish()
     WriteLog( "Sound manager finish complete.\n" );
 }
 
-void SoundManager::ProcessSounds( uchar* output )
+void SoundManager::Process()
 {
-    memset( output, SoundSpec.silence, SoundSpec.size );
+    if( !isActive )
+        return;
 
+    // Finished sounds deleted only here, so streams can be decoded without device lock
+    soundsStreaming.clear();
+    SDL_LockAudioDevice( DeviceID );
     for( auto it = soundsActive.begin(); it != soundsActive.end();)
     {
         Sound* sound = *it;
-        if( SndMngr.ProcessSound( sound, &outputBuf[ 0 ] ) )
+        if( sound->IsFinished )
         {
-            int volume = CLAMP( sound->IsMusic ? GameOpt.MusicVolume : GameOpt.SoundVolume, 0, 100 ) * SDL_MIX_MAXVOLUME / 100;
-            SDL_MixAudioFormat( output, &outputBuf[ 0 ], SoundSpec.format, SoundSpec.size, volume );
-            ++it;
+            delete sound;
+            it = soundsActive.erase( it );
+            continue;
+        }
+
+        if( sound->OggStream )
+            soundsStreaming.push_back( sound );
+        ++it;
+    }
+    SDL_UnlockAudioDevice( DeviceID );
+
+    // Decode next stream parts out of audio callback
+    for( Sound* sound : soundsStreaming )
+    {
+        SDL_AtomicLock( &sound->StreamLock );
+        if( !sound->NextReady && !sound->StreamEnded )
+            sound->NextReady = StreamOGG( sound, true );
+        SDL_AtomicUnlock( &sound->StreamLock );
+    }
+}
+
+void SoundManager::ProcessSounds( uchar* output )
+{
+    // Mix in floats with volume of each sound and clamp once at the end
+    bool   mix_s16 = ( SoundSpec.format == AUDIO_S16SYS );
+    bool   mix_f32 = ( SoundSpec.format == AUDIO_F32SYS );
+    uint   samples = (uint) mixBuf.size();
+    float* mix = &mixBuf[ 0 ];
+    if( mix_s16 || mix_f32 )
+        memset( mix, 0, samples * sizeof( float ) );
+    else
+        memset( output, SoundSpec.silence, SoundSpec.size );
+
+    for( Sound* sound : soundsActive )
+    {
+        if( sound->IsFinished )
+            continue;
+
+        if( !SndMngr.ProcessSound( sound, &outputBuf[ 0 ] ) )
+        {
+            sound->IsFinished = true;
+            continue;
+        }
+
+        int volume = CLAMP( sound->IsMusic ? GameOpt.MusicVolume : GameOpt.SoundVolume, 0, 100 );
+        if( !volume )
+            continue;
+
+        float gain = (float) volume / 100.0f;
+        if( mix_s16 )
+        {
+            const short* src = (const short*) &outputBuf[ 0 ];
+            for( uint i = 0; i < samples; i++ )
+                mix[ i ] += (float) src[ i ] * gain;
+        }
+        else if( mix_f32 )
+        {
+            const float* src = (const float*) &outputBuf[ 0 ];
+            for( uint i = 0; i < samples; i++ )
+                mix[ i ] += src[ i ] * gain;
         }
         else
         {
-            delete sound;
-            it = soundsActive.erase( it );
+            SDL_MixAudioFormat( output, &outputBuf[ 0 ], SoundSpec.format, SoundSpec.size, volume * SDL_MIX_MAXVOLUME / 100 );
         }
     }
+
+    if( mix_s16 )
+    {
+        short* dst = (short*) output;
+        for( uint i = 0; i < samples; i++ )
+            dst[ i ] = (short) CLAMP( mix[ i ], -32768.0f, 32767.0f );
+    }
+    else if( mix_f32 )
+    {
+        float* dst = (float*) output;
+        for( uint i = 0; i < samples; i++ )
+            dst[ i ] = CLAMP( mix[ i ], -1.0f, 1.0f );
+    }
 }
 
 bool SoundManager::ProcessSound( Sound* sound, uchar* output )
@@ -164,7 +274,7 @@ bool SoundManager::ProcessSound( Sound* sound, uchar* output )
             sound->ConvertedBufCur += offset;
 
             // Stream new parts
-            while( offset < whole && sound->OggStream && StreamOGG( sound ) )
+            while( offset < whole && sound->OggStream && NextStreamPart( sound ) )
             {
                 uint write = sound->ConvertedBufSize - sound->ConvertedBufCur;
                 if( offset + write > whole )
@@ -186,12 +296,25 @@ bool SoundManager::ProcessSound( Sound* sound, uchar* output )
         }
 
         if( sound->OggStream && sound->ConvertedBufCur == sound->ConvertedBufSize )
-            StreamOGG( sound );
+            NextStreamPart( sound );
 
         // Continue processing
         return true;
     }
 
+    // Stream part was not taken because of main thread decoding
+    if( sound->OggStream && !sound->StreamEnded )
+    {
+        if( NextStreamPart( sound ) )
+            return ProcessSound( sound, output );
+
+        if( !sound->StreamEnded )
+        {
+            memset( output, SoundSpec.silence, whole );
+            return true;
+        }
+    }
+
     // Repeat
     if( sound->RepeatTime )
     {
@@ -203,10 +326,22 @@ bool SoundManager::ProcessSound( Sound* sound, uchar* output )
 
         if( Timer::GameTick() >= sound->NextPlay )
         {
-            // Set buffer to beginning
-            sound->ConvertedBufCur = 0;
+            // Set buffer to beginning, stream busy in main thread, try next time
             if( sound->OggStream )
+            {
+                if( !SDL_AtomicTryLock( &sound->StreamLock ) )
+                {
+                    memset( output, SoundSpec.silence, whole );
+                    return true;
+                }
+
                 ov_raw_seek( sound->OggStream, 0 );
+                sound->NextReady = false;
+                sound->StreamEnded = false;
+                StreamOGG( sound, false );
+                SDL_AtomicUnlock( &sound->StreamLock );
+            }
+            sound->ConvertedBufCur = 0;
 
             // Drop timer
             sound->NextPlay = 0;
@@ -225,6 +360,34 @@ bool SoundManager::ProcessSound( Sound* sound, uchar* output )
     return false;
 }
 
+bool SoundManager::NextStreamPart( Sound* sound )
+{
+    // Main thread decodes right now, so wait for it
+    if( !SDL_AtomicTryLock( &sound->StreamLock ) )
+        return false;
+
+    // Take part decoded ahead or decode in place if main thread not in time
+    bool result;
+    if( sound->NextReady )
+    {
+        std::swap( sound->ConvertedBuf, sound->NextBuf );
+        std::swap( sound->ConvertedBufRealSize, sound->NextBufRealSize );
+        sound->ConvertedBufSize = sound->NextBufSize;
+        sound->ConvertedBufCur = 0;
+        sound->NextReady = false;
+        result = true;
+    }
+    else
+    {
+        result = StreamOGG( sound, false );
+        if( !result )
+            sound->StreamEnded = true;
+    }
+
+    SDL_AtomicUnlock( &sound->StreamLock );
+    return result;
+}
+
 Sound* SoundManager::Load( const string& fname, bool is_music )
 {
     string fixed_fname = fname;
@@ -238,12 +401,18 @@ Sound* SoundManager::Load( const string& fname, bool is_music )
     }
 
     Sound* sound = new Sound();
-    if( !( ( ext == "wav" && LoadWAV( sound, fixed_fname ) ) ||
-           ( ext == "acm" && LoadACM( sound, fixed_fname, is_music ) ) ||
-           ( ext == "ogg" && LoadOGG( sound, fixed_fname ) ) ) )
+    if( is_music || !LoadCached( sound, fixed_fname ) )
     {
-        delete sound;
-        return nullptr;
+        if( !( ( ext == "wav" && LoadWAV( sound, fixed_fname ) ) ||
+               ( ext == "acm" && LoadACM( sound, fixed_fname, is_music ) ) ||
+               ( ext == "ogg" && LoadOGG( sound, fixed_fname ) ) ) )
+        {
+            delete sound;
+            return nullptr;
+        }
+
+        if( !is_music && !sound->OggStream )
+            AddToCache( sound, fixed_fname );
     }
 
     SDL_LockAudioDevice( DeviceID );
@@ -252,6 +421,61 @@ Sound* SoundManager::Load( const string& fname, bool is_music )
     return sound;
 }
 
+bool SoundManager::LoadCached( Sound* sound, const string& fname )
+{
+    auto it = SoundsCache.find( fname );
+    if( it == SoundsCache.end() )
+        return false;
+
+    SoundData* data = it->second;
+    data->RefCount++;
+    data->LastUse = Timer::FastTick();
+    sound->Shared = data;
+    sound->ConvertedBuf = data->Buf;
+    sound->ConvertedBufRealSize = data->Size;
+    sound->ConvertedBufSize = data->Size;
+    sound->ConvertedBufCur = 0;
+    return true;
+}
+
+void SoundManager::AddToCache( Sound* sound, const string& fname )
+{
+    // Free least recently used sounds that not playing now
+    while( SoundsCacheSize + sound->ConvertedBufSize > SOUNDS_CACHE_MAX_SIZE )
+    {
+        auto oldest = SoundsCache.end();
+        for( auto it = SoundsCache.begin(); it != SoundsCache.end(); ++it )
+            if( !it->second->RefCount && ( oldest == SoundsCache.end() || it->second->LastUse < oldest->second->LastUse ) )
+                oldest = it;
+        if( oldest == SoundsCache.end() )
+            return;
+
+        SoundsCacheSize -= oldest->second->Size;
+        delete oldest->second;
+        SoundsCache.erase( oldest );
+    }
+
+    // Cache takes converted buffer
+    SoundData* data = new SoundData();
+    data->Buf = sound->ConvertedBuf;
+    data->Size = sound->ConvertedBufSize;
+    data->RefCount = 1;
+    data->LastUse = Timer::FastTick();
+    SoundsCache.insert( std::make_pair( fname, data ) );
+    SoundsCacheSize += data->Size;
+    sound->Shared = data;
+    SAFEDELA( sound->BaseBuf );
+}
+
+void SoundManager::ClearCache()
+{
+    // Called after all sounds stopped
+    for( auto it = SoundsCache.begin(); it != SoundsCache.end(); ++it )
+        delete it->second;
+    SoundsCache.clear();
+    SoundsCacheSize = 0;
+}
+
 bool SoundManager::LoadWAV( Sound* sound, const string& fname )
 {
     FileManager fm;
@@ -350,7 +574,7 @@ bool SoundManager::LoadWAV( Sound* sound, const string& fname )
         return false;
     }
 
-    return ConvertData( sound );
+    return ConvertData( sound, false );
 }
 
 bool SoundManager::LoadACM( Sound* sound, const string& fname, bool is_music )
@@ -379,7 +603,7 @@ bool SoundManager::LoadACM( Sound* sound, const string& fname, bool is_music )
         return false;
     }
 
-    return ConvertData( sound );
+    return ConvertData( sound, false );
 }
 
 static size_t Ogg_read_func( void* ptr, size_t size, size_t nmemb, void* datasource )
@@ -500,10 +724,10 @@ bool SoundManager::LoadOGG( Sound* sound, const string& fname )
         SAFEDEL( sound->OggStream );
     }
 
-    return ConvertData( sound );
+    return ConvertData( sound, false );
 }
 
-bool SoundManager::StreamOGG( Sound* sound )
+bool SoundManager::StreamOGG( Sound* sound, bool ahead )
 {
     int  result = 0;
     uint decoded = 0;
@@ -520,10 +744,10 @@ bool SoundManager::StreamOGG( Sound* sound )
         return false;
 
     sound->BaseBufSize = decoded;
-    return ConvertData( sound );
+    return ConvertData( sound, ahead );
 }
 
-bool SoundManager::ConvertData( Sound* sound )
+bool SoundManager::ConvertData( Sound* sound, bool ahead )
 {
     if( !sound->CvtBuilded )
     {
@@ -536,14 +760,18 @@ bool SoundManager::ConvertData( Sound* sound )
         }
     }
 
+    // Stream part decoded ahead goes to separate buffer, current one still playing
+    uchar*& buf = ( ahead ? sound->NextBuf : sound->ConvertedBuf );
+    uint&   buf_real_size = ( ahead ? sound->NextBufRealSize : sound->ConvertedBufRealSize );
+
     sound->Cvt.len = sound->BaseBufSize;
-    if( sound->Cvt.len * sound->Cvt.len_mult > (int) sound->ConvertedBufRealSize )
+    if( sound->Cvt.len * sound->Cvt.len_mult > (int) buf_real_size )
     {
-        sound->ConvertedBufRealSize = sound->Cvt.len * sound->Cvt.len_mult * 4;
-        SAFEDELA( sound->ConvertedBuf );
-        sound->ConvertedBuf = new unsigned char[ sound->ConvertedBufRealSize ];
+        buf_real_size = sound->Cvt.len * sound->Cvt.len_mult * 4;
+        SAFEDELA( buf );
+        buf = new unsigned char[ buf_real_size ];
     }
-    sound->Cvt.buf = (Uint8*) sound->ConvertedBuf;
+    sound->Cvt.buf = (Uint8*) buf;
     memcpy( sound->Cvt.buf, sound->BaseBuf, sound->BaseBufSize );
 
     if( SDL_ConvertAudio( &sound->Cvt ) )
@@ -552,8 +780,15 @@ bool SoundManager::ConvertData( Sound* sound )
         return false;
     }
 
-    sound->ConvertedBufCur = 0;
-    sound->ConvertedBufSize = sound->Cvt.len_cvt;
+    if( ahead )
+    {
+        sound->NextBufSize = sound->Cvt.len_cvt;
+    }
+    else
+    {
+        sound->ConvertedBufCur = 0;
+        sound->ConvertedBufSize = sound->Cvt.len_cvt;
+    }
 
     return true;
 }
@@ -17,21 +17,28 @@ public:
     bool PlayMusic( const string& fname, uint repeat_time );
     void StopSounds();
     void StopMusic();
+    void Process();
 
 private:
     void   ProcessSounds( uchar* output );
     bool   ProcessSound( Sound* sound, uchar* output );
+    bool   NextStreamPart( Sound* sound );
+    bool   LoadCached( Sound* sound, const string& fname );
+    void   AddToCache( Sound* sound, const string& fname );
+    void   ClearCache();
     Sound* Load( const string& fname, bool is_music );
     bool   LoadWAV( Sound* sound, const string& fname );
     bool   LoadACM( Sound* sound, const string& fname, bool is_music );
     bool   LoadOGG( Sound* sound, const string& fname );
-    bool   StreamOGG( Sound* sound );
-    bool   ConvertData( Sound* sound );
+    bool   StreamOGG( Sound* sound, bool ahead );
+    bool   ConvertData( Sound* sound, bool ahead );
 
     bool     isActive;
     uint     streamingPortion;
     SoundVec soundsActive;
+    SoundVec soundsStreaming;
     UCharVec outputBuf;
+    FloatVec mixBuf;
 };
 
 extern SoundManager SndMngr;
@@ -17,6 +17,9 @@ AnyFrames*    SpriteManager::DummyAnimation = nullptr;
 #define ARRAY_BUFFERS_COUNT      ( 300 )
 
 #define FAST_FORMAT_SIGNATURE    ( 0xDEADBEEF ) // Must be really unique
+#define FAST_FORMAT_PACKED       ( 0xDEADBEF0 ) // Frames compressed, with frames index
+#define FAST_FORMAT_VERSION      ( 1 )
+#define FAST_FORMAT_COMMIT_SIZE  ( 16 * 1024 * 1024 )
 
 bool OGL_version_2_0 = false;
 bool OGL_vertex_buffer_object = false;
@@ -59,6 +62,9 @@ SpriteManager::SpriteManager()
 
     atlasWidth = atlasHeight = 0;
     accumulatorActive = false;
+    fastFormatRecord = false;
+    fastFormatSkip = false;
+    fastFormatUncommitted = 0;
 }
 
 bool SpriteManager::Init()
@@ -291,6 +297,8 @@ void SpriteManager::Finish()
 {
     WriteLog( "Sprite manager finish...\n" );
 
+    CommitFastFormatCache();
+
     DeleteRenderTarget( rtMain );
     DeleteRenderTarget( rtContours );
     DeleteRenderTarget( rtContoursMid );
@@ -990,6 +998,7 @@ void SpriteManager::AccumulateAtlasData()
 void SpriteManager::FlushAccumulatedAtlasData()
 {
     accumulatorActive = false;
+    CommitFastFormatCache();
     if( accumulatorSprInfo.empty() )
         return;
 
@@ -1027,9 +1036,7 @@ TextureAtlas* SpriteManager::CreateAtlas( int w, int h )
     atlas->RT->LastPixelPicks = new UIntPairVec();
     atlas->RT->LastPixelPicks->reserve( MAX_STORED_PIXEL_PICKS );
     atlas->TextureOwner = atlas->RT->TargetTexture;
-    atlas->Width = w;
-    atlas->Height = h;
-    atlas->RootNode = ( accumulatorActive ? new TextureAtlas::SpaceNode( 0, 0, w, h ) : nullptr );
+    atlas->Init( w, h );
     allAtlases.push_back( atlas );
     return atlas;
 }
@@ -1044,67 +1051,19 @@ TextureAtlas* SpriteManager::FindAtlasPlace( SpriteInfo* si, int& x, int& y )
     for( auto it = allAtlases.begin(), end = allAtlases.end(); it != end; ++it )
     {
         TextureAtlas* a = *it;
-        if( a->Type != atlas_type )
-            continue;
-
-        if( a->RootNode  )
-        {
-            if( a->RootNode->FindPosition( w, h, x, y ) )
-                atlas = a;
-        }
-        else
+        if( a->Type == atlas_type && a->FindPosition( w, h, x, y ) )
         {
-            if( w <= a->LineW && a->LineCurH + h <= a->LineMaxH )
-            {
-                x = a->CurX - a->LineW;
-                y = a->CurY + a->LineCurH;
-                a->LineCurH += h;
-                atlas = a;
-            }
-            else if( a->Width - a->CurX >= w && a->Height - a->CurY >= h )
-            {
-                x = a->CurX;
-                y = a->CurY;
-                a->CurX += w;
-                a->LineW = w;
-                a->LineCurH = h;
-                a->LineMaxH = MAX( a->LineMaxH, h );
-                atlas = a;
-            }
-            else if( a->Width >= w && a->Height - a->CurY - a->LineMaxH >= h )
-            {
-                x = 0;
-                y = a->CurY + a->LineMaxH;
-                a->CurX = w;
-                a->CurY = y;
-                a->LineW = w;
-                a->LineCurH = h;
-                a->LineMaxH = h;
-                atlas = a;
-            }
-        }
-
-        if( atlas )
+            atlas = a;
             break;
+        }
     }
 
     // Create new
     if( !atlas )
     {
         atlas = CreateAtlas( w, h );
-        if( atlas->RootNode )
-        {
-            atlas->RootNode->FindPosition( w, h, x, y );
-        }
-        else
-        {
-            x = atlas->CurX;
-            y = atlas->CurY;
-            atlas->CurX += w;
-            atlas->LineMaxH = h;
-            atlas->LineCurH = h;
-            atlas->LineW = w;
-        }
+        if( !atlas->FindPosition( w, h, x, y ) )
+            x = y = 0;
     }
 
     // Return parameters
@@ -1159,7 +1118,8 @@ void SpriteManager::DumpAtlases()
     for( auto it = allAtlases.begin(), end = allAtlases.end(); it != end; ++it )
     {
         TextureAtlas* atlas = *it;
-        string        fname = _str( "{}{}_{}_{}x{}.png", path, cnt, atlas->Type, atlas->Width, atlas->Height );
+        uint          used = (uint) ( (uint64) atlas->UsedArea * 100 / ( atlas->Width * atlas->Height ) );
+        string        fname = _str( "{}{}_{}_{}x{}_{}.png", path, cnt, atlas->Type, atlas->Width, atlas->Height, used );
         SaveTexture( atlas->TextureOwner, fname, false );
         cnt++;
     }
@@ -1230,6 +1190,10 @@ uint SpriteManager::RequestFillAtlas( SpriteInfo* si, uint w, uint h, uchar* dat
         sprData[ index ] = si;
     else
         sprData.push_back( si );
+
+    // Pixels freed after placing to atlas, keep copy for fast format cache
+    if( fastFormatRecord && data )
+        fastFormatFrames[ index ] = UCharVec( data, data + w * h * 4 );
     return index;
 }
 
@@ -1305,6 +1269,29 @@ AnyFrames* SpriteManager::LoadAnimation( const string& fname, bool use_dummy /*
         return dummy;
     }
 
+    // Decoded 2d animations cached in packed fast format until source file changed
+    bool   cache_anim = ( GameOpt.SpriteCache && !fastFormatRecord && !Is3dExtensionSupported( ext ) );
+    string cache_name = _str( "$fast:{}{}", fname, frm_anim_pix ? ":pix" : "" );
+    uint64 write_time = 0;
+    if( cache_anim )
+    {
+        FileManager src;
+        cache_anim = src.LoadFile( fname, true );
+        write_time = src.GetWriteTime();
+    }
+    if( cache_anim )
+    {
+        UCharVec cache;
+        if( Crypt.GetCache( cache_name, cache ) && cache.size() > sizeof( write_time ) && !memcmp( &cache[ 0 ], &write_time, sizeof( write_time ) ) )
+        {
+            FileManager fm( &cache[ sizeof( write_time ) ], (uint) ( cache.size() - sizeof( write_time ) ) );
+            AnyFrames*  anim;
+            if( LoadAnimationInFastFormat( fname, fm, anim ) && anim )
+                return anim;
+        }
+        fastFormatRecord = true;
+    }
+
     AnyFrames* result = nullptr;
     if( ext == "png" )
         result = LoadAnimationOther( fname, &GraphicLoader::LoadPNG );
@@ -1333,6 +1320,23 @@ AnyFrames* SpriteManager::LoadAnimation( const string& fname, bool use_dummy /*
     else
         WriteLog( "Unsupported image file format '{}', file '{}'.\n", ext, fname );
 
+    if( cache_anim )
+    {
+        FileManager fm;
+        fm.SetData( &write_time, sizeof( write_time ) );
+        if( result && !fastFormatSkip && SaveAnimationInFastFormat( result, fm ) )
+        {
+            // Commit in batches, each commit flushes cache file
+            Crypt.SetCache( cache_name, fm.GetOutBuf(), fm.GetOutBufLen(), false );
+            fastFormatUncommitted += fm.GetOutBufLen();
+            if( fastFormatUncommitted >= FAST_FORMAT_COMMIT_SIZE )
+                CommitFastFormatCache();
+        }
+        fastFormatRecord = false;
+        fastFormatSkip = false;
+        fastFormatFrames.clear();
+    }
+
     return result ? result : dummy;
 }
 
@@ -3359,17 +3363,35 @@ void SpriteManager::FreePure3dAnimation( Animation3d* anim3d )
     }
 }
 
-bool SpriteManager::SaveAnimationInFastFormat( AnyFrames* anim, const string& fname )
+bool SpriteManager::SaveAnimationInFastFormat( AnyFrames* anim, FileManager& fm )
 {
-    FileManager fm;
-    fm.SetBEUInt( FAST_FORMAT_SIGNATURE );
+    // Compress frames, pixels data recorded before sprites placed to atlas
+    vector< UCharVec > packed;
+    for( int dir = 0; dir < anim->DirCount(); dir++ )
+    {
+        AnyFrames* dir_anim = anim->GetDir( dir );
+        for( ushort i = 0; i < dir_anim->CntFrm; i++ )
+        {
+            auto it = fastFormatFrames.find( dir_anim->Ind[ i ] );
+            if( it == fastFormatFrames.end() )
+                return false;
+
+            packed.push_back( it->second );
+            if( !packed.back().empty() && !Crypt.Compress( packed.back() ) )
+                return false;
+        }
+    }
+
+    // Header and frames index, then frames data
+    fm.SetBEUInt( FAST_FORMAT_PACKED );
+    fm.SetBEUShort( FAST_FORMAT_VERSION );
     fm.SetBEUShort( anim->CntFrm );
     fm.SetBEUInt( anim->Ticks );
     fm.SetBEUShort( anim->DirCount() );
-    for( int dir = 0; dir < anim->DirCount(); dir++ )
+    for( int dir = 0, frm = 0; dir < anim->DirCount(); dir++ )
     {
         AnyFrames* dir_anim = anim->GetDir( dir );
-        for( ushort i = 0; i < dir_anim->CntFrm; i++ )
+        for( ushort i = 0; i < dir_anim->CntFrm; i++, frm++ )
         {
             SpriteInfo* si = GetSpriteInfo( dir_anim->Ind[ i ] );
             fm.SetBEUShort( si->Width );
@@ -3378,10 +3400,22 @@ bool SpriteManager::SaveAnimationInFastFormat( AnyFrames* anim, const string& fn
             fm.SetBEShort( si->OffsY );
             fm.SetBEShort( dir_anim->NextX[ i ] );
             fm.SetBEShort( dir_anim->NextY[ i ] );
-            fm.SetData( si->Data, si->Width * si->Height * 4 );
+            fm.SetBEUInt( (uint) packed[ frm ].size() );
         }
     }
-    return fm.SaveFile( fname );
+    for( size_t i = 0; i < packed.size(); i++ )
+        if( !packed[ i ].empty() )
+            fm.SetData( &packed[ i ][ 0 ], (uint) packed[ i ].size() );
+    return true;
+}
+
+void SpriteManager::CommitFastFormatCache()
+{
+    if( fastFormatUncommitted )
+    {
+        Crypt.CommitCache();
+        fastFormatUncommitted = 0;
+    }
 }
 
 bool SpriteManager::TryLoadAnimationInFastFormat( const string& fname, FileManager& fm, AnyFrames*& anim )
@@ -3393,8 +3427,22 @@ bool SpriteManager::TryLoadAnimationInFastFormat( const string& fname, FileManag
     if( !fm.LoadFile( fname ) )
         return true;
 
+    return LoadAnimationInFastFormat( fname, fm, anim );
+}
+
+bool SpriteManager::LoadAnimationInFastFormat( const string& fname, FileManager& fm, AnyFrames*& anim )
+{
+    // Null result
+    anim = nullptr;
+
     // Check for fonline cached format
-    if( fm.GetFsize() >= 12 && fm.GetBEUInt() == FAST_FORMAT_SIGNATURE )
+    uint signature = ( fm.GetFsize() >= 12 ? fm.GetBEUInt() : 0 );
+
+    // Source already in fast format, no need to cache it again
+    if( fastFormatRecord && ( signature == FAST_FORMAT_SIGNATURE || signature == FAST_FORMAT_PACKED ) )
+        fastFormatSkip = true;
+
+    if( signature == FAST_FORMAT_SIGNATURE )
     {
         ushort frames_count = fm.GetBEUShort();
         uint   ticks = fm.GetBEUInt();
@@ -3407,7 +3455,7 @@ bool SpriteManager::TryLoadAnimationInFastFormat( const string& fname, FileManag
 
         for( ushort dir = 0; dir < dirs; dir++ )
         {
-            AnyFrames* dir_anim = anim;
+            AnyFrames* dir_anim = anim->GetDir( dir );
             for( ushort i = 0; i < frames_count; i++ )
             {
                 SpriteInfo* si = new SpriteInfo();
@@ -3417,9 +3465,68 @@ bool SpriteManager::TryLoadAnimationInFastFormat( const string& fname, FileManag
                 si->OffsY = fm.GetBEShort();
                 dir_anim->NextX[ i ] = fm.GetBEShort();
                 dir_anim->NextY[ i ] = fm.GetBEShort();
-                uchar* data = fm.GetCurBuf();
+                uchar* data = new uchar[ w * h * 4 ];
+                fm.CopyMem( data, w * h * 4 );
+                dir_anim->Ind[ i ] = RequestFillAtlas( si, w, h, data );
+            }
+        }
+        return true;
+    }
+    else if( signature == FAST_FORMAT_PACKED && fm.GetBEUShort() == FAST_FORMAT_VERSION )
+    {
+        ushort frames_count = fm.GetBEUShort();
+        uint   ticks = fm.GetBEUInt();
+        ushort dirs = fm.GetBEUShort();
+        RUNTIME_ASSERT( dirs == 1 || dirs == DIRS_COUNT );
+
+        // Check frames index before unpacking
+        uint index_pos = fm.GetCurPos();
+        uint index_size = dirs * frames_count * 16;
+        uint data_size = 0;
+        bool index_ok = ( fm.GetFsize() >= index_pos + index_size );
+        for( uint i = 0, j = dirs * frames_count; i < j && index_ok; i++ )
+        {
+            fm.SetCurPos( index_pos + i * 16 + 12 );
+            data_size += fm.GetBEUInt();
+        }
+        if( !index_ok || fm.GetFsize() < index_pos + index_size + data_size )
+        {
+            WriteLog( "Truncated fast format animation '{}'.\n", fname );
+            return true;
+        }
+
+        anim = AnyFrames::Create( frames_count, ticks );
+        if( dirs > 1 )
+            anim->CreateDirAnims();
+
+        uint data_pos = index_pos + index_size;
+        for( ushort dir = 0; dir < dirs; dir++ )
+        {
+            AnyFrames* dir_anim = anim->GetDir( dir );
+            for( ushort i = 0; i < frames_count; i++ )
+            {
+                fm.SetCurPos( index_pos + ( dir * frames_count + i ) * 16 );
+                SpriteInfo* si = new SpriteInfo();
+                ushort      w = fm.GetBEUShort();
+                ushort      h = fm.GetBEUShort();
+                si->OffsX = fm.GetBEShort();
+                si->OffsY = fm.GetBEShort();
+                dir_anim->NextX[ i ] = fm.GetBEShort();
+                dir_anim->NextY[ i ] = fm.GetBEShort();
+                uint packed_len = fm.GetBEUInt();
+
+                // Unpacked buffer goes to atlas
+                uint   data_len = packed_len;
+                uchar* data = ( packed_len ? Crypt.Uncompress( fm.GetBuf() + data_pos, data_len, w * h * 4 / packed_len + 1 ) : new uchar[ 0 ] );
+                if( !data || data_len != (uint) w * h * 4 )
+                {
+                    WriteLog( "Invalid frame {} in fast format animation '{}'.\n", i, fname );
+                    SAFEDELA( data );
+                    data = new uchar[ w * h * 4 ];
+                    memzero( data, w * h * 4 );
+                }
                 dir_anim->Ind[ i ] = RequestFillAtlas( si, w, h, data );
-                fm.GoForward( w * h * 4 );
+                data_pos += packed_len;
             }
         }
         return true;
@@ -152,12 +152,19 @@ public:
     Animation3d* LoadPure3dAnimation( const string& fname, bool auto_redraw );
     void         RefreshPure3dAnimationSprite( Animation3d* anim3d );
     void         FreePure3dAnimation( Animation3d* anim3d );
-    bool         SaveAnimationInFastFormat( AnyFrames* anim, const string& fname );
+    bool         SaveAnimationInFastFormat( AnyFrames* anim, FileManager& fm );
     bool         TryLoadAnimationInFastFormat( const string& fname, FileManager& fm, AnyFrames*& anim );
+    bool         LoadAnimationInFastFormat( const string& fname, FileManager& fm, AnyFrames*& anim );
 
 private:
-    SprInfoVec     sprData;
-    Animation3dVec autoRedrawAnim3d;
+    SprInfoVec            sprData;
+    Animation3dVec        autoRedrawAnim3d;
+    bool                  fastFormatRecord;
+    bool                  fastFormatSkip;
+    map< uint, UCharVec > fastFormatFrames; // Decoded pixels of animation being cached, by sprite index
+    uint                  fastFormatUncommitted;
+
+    void CommitFastFormatCache();
 
     AnyFrames* CreateAnimation( uint frames, uint ticks );
     AnyFrames* LoadAnimationFrm( const string& fname, bool anim_pix );
@@ -7,6 +7,7 @@
 #define FORMAT_TYPE_DRAW      ( 0 )
 #define FORMAT_TYPE_SPLIT     ( 1 )
 #define FORMAT_TYPE_LCOUNT    ( 2 )
+#define FONT_LAYOUTS_MAX_SIZE ( 4 * 1024 * 1024 )
 
 struct Letter
 {
@@ -132,8 +133,66 @@ struct FontFormatInfo
     }
 };
 
+// Formatted text cache, most texts are same from frame to frame
+struct FontLayout
+{
+    bool        IsError;
+    Vertex2DVec Vertices;
+    uint        LinesInRect;
+    int         Width;
+    uint        Size;         // Approximate memory usage, text and vertices
+};
+typedef tuple< int, FontData*, uint, int, int, int, int, uint, string > FontLayoutKey; // Format type, font, flags, region, color, text
+typedef list< pair< FontLayoutKey, FontLayout > >                      FontLayoutList;
+typedef map< FontLayoutKey, FontLayoutList::iterator >                 FontLayoutMap;
+
+static FontLayoutList LayoutsUsage; // Recently used first
+static FontLayoutMap  Layouts;
+static uint           LayoutsSize;
+
+static FontLayout& GetFontLayout( int fmt_type, FontData* font, uint flags, const Rect& r, uint color, const string& str, bool& created )
+{
+    FontLayoutKey key( fmt_type, font, flags, r.L, r.T, r.R, r.B, color, str );
+
+    auto it = Layouts.find( key );
+    if( it != Layouts.end() )
+    {
+        LayoutsUsage.splice( LayoutsUsage.begin(), LayoutsUsage, it->second );
+        created = false;
+        return it->second->second;
+    }
+
+    // Limited by memory, long texts take much more than short ones
+    while( !LayoutsUsage.empty() && LayoutsSize > FONT_LAYOUTS_MAX_SIZE )
+    {
+        LayoutsSize -= LayoutsUsage.back().second.Size;
+        Layouts.erase( LayoutsUsage.back().first );
+        LayoutsUsage.pop_back();
+    }
+
+    LayoutsUsage.push_front( std::make_pair( key, FontLayout() ) );
+    Layouts.insert( std::make_pair( key, LayoutsUsage.begin() ) );
+    created = true;
+    return LayoutsUsage.front().second;
+}
+
+// Call after created layout filled
+static void CountFontLayout( FontLayout& layout, const string& str )
+{
+    layout.Size = (uint) ( sizeof( FontLayoutList::value_type ) * 2 + str.length() * 2 + layout.Vertices.capacity() * sizeof( Vertex2D ) );
+    LayoutsSize += layout.Size;
+}
+
+static void ClearFontLayouts()
+{
+    Layouts.clear();
+    LayoutsUsage.clear();
+    LayoutsSize = 0;
+}
+
 void SpriteManager::ClearFonts()
 {
+    ClearFontLayouts();
     for( size_t i = 0; i < Fonts.size(); i++ )
         SAFEDEL( Fonts[ i ] );
     Fonts.clear();
@@ -163,6 +222,7 @@ void SpriteManager::BuildFont( int index )
 {
     FontData& font = *Fonts[ index ];
     font.Builded = true;
+    ClearFontLayouts();
 
     // Fix texture coordinates
     SpriteInfo* si = GetSpriteInfo( font.ImageNormal->GetSprId( 0 ) );
@@ -499,6 +559,7 @@ bool SpriteManager::LoadFontFO( int index, const string& font_name, bool not_bor
         Fonts.resize( index + 1 );
     SAFEDEL( Fonts[ index ] );
     Fonts[ index ] = new FontData( font );
+    ClearFontLayouts();
 
     return true;
 }
@@ -619,6 +680,7 @@ bool SpriteManager::LoadFontBMF( int index, const string& font_name )
         Fonts.resize( index + 1 );
     SAFEDEL( Fonts[ index ] );
     Fonts[ index ] = new FontData( font );
+    ClearFontLayouts();
 
     return true;
 }
@@ -1065,38 +1127,21 @@ void FormatText( FontFormatInfo& fi, int fmt_type )
         fi.CurY = r.B - (int) ( fi.LinesInRect * font->LineHeight + ( fi.LinesInRect - 1 ) * font->YAdvance );
 }
 
-bool SpriteManager::DrawStr( const Rect& r, const string& str, uint flags, uint color /* = 0 */, int num_font /* = -1 */ )
+static void MakeDrawLayout( FontLayout& layout, FontData* font, const Rect& r, uint flags, uint color, const string& str )
 {
-    // Check
-    if( str.empty() )
-        return false;
-
-    // Get font
-    FontData* font = GetFont( num_font );
-    if( !font )
-        return false;
-
-    // FormatBuf
-    if( !color && DefFontColor )
-        color = DefFontColor;
-    color = COLOR_SWAP_RB( color );
-
     static FontFormatInfo fi;
     fi.Init( font, flags, r, str.c_str() );
     fi.DefColor = color;
     FormatText( fi, FORMAT_TYPE_DRAW );
+    layout.IsError = fi.IsError;
     if( fi.IsError )
-        return false;
-
-    char*    str_ = fi.PStr;
-    uint     offs_col = fi.OffsColDots;
-    int      curx = fi.CurX;
-    int      cury = fi.CurY;
-    int      curstr = 0;
-    Texture* texture = ( FLAG( flags, FT_BORDERED ) && font->FontTexBordered ? font->FontTexBordered : font->FontTex );
+        return;
 
-    if( curDrawQuad )
-        Flush();
+    char* str_ = fi.PStr;
+    uint  offs_col = fi.OffsColDots;
+    int   curx = fi.CurX;
+    int   cury = fi.CurY;
+    int   curstr = 0;
 
     if( !FLAG( flags, FT_NO_COLORIZE ) )
     {
@@ -1161,7 +1206,7 @@ bool SpriteManager::DrawStr( const Rect& r, const string& str, uint flags, uint
 
             Letter& l = it->second;
 
-            int     pos = curDrawQuad * 4;
+            size_t  pos = layout.Vertices.size();
             int     x = curx - l.OffsX - 1;
             int     y = cury - l.OffsY - 1;
             int     w = l.W + 2;
@@ -1173,41 +1218,85 @@ bool SpriteManager::DrawStr( const Rect& r, const string& str, uint flags, uint
             float   x2 = texture_uv[ 2 ];
             float   y2 = texture_uv[ 3 ];
 
-            vBuffer[ pos ].X = (float) x;
-            vBuffer[ pos ].Y = (float) y + h;
-            vBuffer[ pos ].TU = x1;
-            vBuffer[ pos ].TV = y2;
-            vBuffer[ pos++ ].Diffuse = color;
-
-            vBuffer[ pos ].X = (float) x;
-            vBuffer[ pos ].Y = (float) y;
-            vBuffer[ pos ].TU = x1;
-            vBuffer[ pos ].TV = y1;
-            vBuffer[ pos++ ].Diffuse = color;
-
-            vBuffer[ pos ].X = (float) x + w;
-            vBuffer[ pos ].Y = (float) y;
-            vBuffer[ pos ].TU = x2;
-            vBuffer[ pos ].TV = y1;
-            vBuffer[ pos++ ].Diffuse = color;
-
-            vBuffer[ pos ].X = (float) x + w;
-            vBuffer[ pos ].Y = (float) y + h;
-            vBuffer[ pos ].TU = x2;
-            vBuffer[ pos ].TV = y2;
-            vBuffer[ pos ].Diffuse = color;
-
-            if( ++curDrawQuad == drawQuadCount )
-            {
-                dipQueue.push_back( DipData( texture, font->DrawEffect ) );
-                dipQueue.back().SpritesCount = curDrawQuad;
-                Flush();
-            }
+            layout.Vertices.resize( pos + 4 );
+            Vertex2D* v = &layout.Vertices[ pos ];
+            memzero( v, sizeof( Vertex2D ) * 4 );
+
+            v[ 0 ].X = (float) x;
+            v[ 0 ].Y = (float) y + h;
+            v[ 0 ].TU = x1;
+            v[ 0 ].TV = y2;
+            v[ 0 ].Diffuse = color;
+
+            v[ 1 ].X = (float) x;
+            v[ 1 ].Y = (float) y;
+            v[ 1 ].TU = x1;
+            v[ 1 ].TV = y1;
+            v[ 1 ].Diffuse = color;
+
+            v[ 2 ].X = (float) x + w;
+            v[ 2 ].Y = (float) y;
+            v[ 2 ].TU = x2;
+            v[ 2 ].TV = y1;
+            v[ 2 ].Diffuse = color;
+
+            v[ 3 ].X = (float) x + w;
+            v[ 3 ].Y = (float) y + h;
+            v[ 3 ].TU = x2;
+            v[ 3 ].TV = y2;
+            v[ 3 ].Diffuse = color;
 
             curx += l.XAdvance;
             variable_space = true;
         }
     }
+}
+
+bool SpriteManager::DrawStr( const Rect& r, const string& str, uint flags, uint color /* = 0 */, int num_font /* = -1 */ )
+{
+    // Check
+    if( str.empty() )
+        return false;
+
+    // Get font
+    FontData* font = GetFont( num_font );
+    if( !font )
+        return false;
+
+    // FormatBuf
+    if( !color && DefFontColor )
+        color = DefFontColor;
+    color = COLOR_SWAP_RB( color );
+
+    bool        created;
+    FontLayout& layout = GetFontLayout( FORMAT_TYPE_DRAW, font, flags, r, color, str, created );
+    if( created )
+    {
+        MakeDrawLayout( layout, font, r, flags, color, str );
+        CountFontLayout( layout, str );
+    }
+    if( layout.IsError )
+        return false;
+
+    Texture* texture = ( FLAG( flags, FT_BORDERED ) && font->FontTexBordered ? font->FontTexBordered : font->FontTex );
+
+    if( curDrawQuad )
+        Flush();
+
+    for( size_t i = 0, j = layout.Vertices.size() / 4; i < j; )
+    {
+        size_t count = std::min( j - i, (size_t) ( drawQuadCount - curDrawQuad ) );
+        memcpy( &vBuffer[ curDrawQuad * 4 ], &layout.Vertices[ i * 4 ], count * 4 * sizeof( Vertex2D ) );
+        curDrawQuad += (int) count;
+        i += count;
+
+        if( curDrawQuad == drawQuadCount )
+        {
+            dipQueue.push_back( DipData( texture, font->DrawEffect ) );
+            dipQueue.back().SpritesCount = curDrawQuad;
+            Flush();
+        }
+    }
 
     if( curDrawQuad )
     {
@@ -1219,6 +1308,23 @@ bool SpriteManager::DrawStr( const Rect& r, const string& str, uint flags, uint
     return true;
 }
 
+static FontLayout& GetLinesLayout( FontData* font, uint flags, const Rect& r, const string& str )
+{
+    bool        created;
+    FontLayout& layout = GetFontLayout( FORMAT_TYPE_LCOUNT, font, flags, r, 0, str, created );
+    if( created )
+    {
+        static FontFormatInfo fi;
+        fi.Init( font, flags, r, str );
+        FormatText( fi, FORMAT_TYPE_LCOUNT );
+        layout.IsError = fi.IsError;
+        layout.LinesInRect = fi.LinesInRect;
+        layout.Width = fi.MaxCurX - fi.Region.L;
+        CountFontLayout( layout, str );
+    }
+    return layout;
+}
+
 int SpriteManager::GetLinesCount( int width, int height, const string& str, int num_font /* = -1 */ )
 {
     if( width <= 0 || height <= 0 )
@@ -1231,13 +1337,11 @@ int SpriteManager::GetLinesCount( int width, int height, const string& str, int
     if( str.empty() )
         return height / ( font->LineHeight + font->YAdvance );
 
-    static FontFormatInfo fi;
-    fi.Init( font, 0, Rect( 0, 0, width ? width : GameOpt.ScreenWidth, height ? height : GameOpt.ScreenHeight ), str );
-    FormatText( fi, FORMAT_TYPE_LCOUNT );
-    if( fi.IsError )
+    FontLayout& layout = GetLinesLayout( font, 0, Rect( 0, 0, width ? width : GameOpt.ScreenWidth, height ? height : GameOpt.ScreenHeight ), str );
+    if( layout.IsError )
         return 0;
 
-    return fi.LinesInRect;
+    return layout.LinesInRect;
 }
 
 int SpriteManager::GetLinesHeight( int width, int height, const string& str, int num_font /* = -1 */ )
@@ -1281,15 +1385,13 @@ void SpriteManager::GetTextInfo( int width, int height, const string& str, int n
         return;
     }
 
-    static FontFormatInfo fi;
-    fi.Init( font, flags, Rect( 0, 0, width, height ), str );
-    FormatText( fi, FORMAT_TYPE_LCOUNT );
-    if( fi.IsError )
+    FontLayout& layout = GetLinesLayout( font, flags, Rect( 0, 0, width, height ), str );
+    if( layout.IsError )
         return;
 
-    lines = fi.LinesInRect;
-    th = fi.LinesInRect * font->LineHeight + ( fi.LinesInRect - 1 ) * font->YAdvance;
-    tw = fi.MaxCurX - fi.Region.L;
+    lines = layout.LinesInRect;
+    th = layout.LinesInRect * font->LineHeight + ( layout.LinesInRect - 1 ) * font->YAdvance;
+    tw = layout.Width;
 }
 
 int SpriteManager::SplitLines( const Rect& r, const string& cstr, int num_font, StrVec& str_vec )
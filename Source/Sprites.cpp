@@ -45,6 +45,12 @@ void Sprite::Unvalidate()
         UnvalidatedPlace->push_back( this );
         UnvalidatedPlace = nullptr;
 
+        if( Tree )
+        {
+            Tree->EraseFromSortIndex( this );
+            Tree = nullptr;
+        }
+
         if( ChainRoot )
             *ChainRoot = ChainChild;
         if( ChainLast )
@@ -182,6 +188,7 @@ Sprites::Sprites()
     rootSprite = nullptr;
     lastSprite = nullptr;
     spriteCount = 0;
+    sortIndexValid = true;
 }
 
 Sprites::~Sprites()
@@ -194,76 +201,154 @@ Sprite* Sprites::RootSprite()
     return rootSprite;
 }
 
-Sprite& Sprites::PutSprite( Sprite* child, int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback )
+static uint GetDrawOrderPos( int draw_order, int hx, int hy )
 {
-    spriteCount++;
+    return draw_order >= DRAW_ORDER_FLAT && draw_order < DRAW_ORDER ?
+           hy * MAXHEX_MAX + hx + MAXHEX_MAX * MAXHEX_MAX * ( draw_order - DRAW_ORDER_FLAT ) :
+           MAXHEX_MAX * MAXHEX_MAX * DRAW_ORDER + hy * DRAW_ORDER * MAXHEX_MAX + hx * DRAW_ORDER + ( draw_order - DRAW_ORDER );
+}
 
-    Sprite* spr;
-    if( !unvalidatedSprites.empty() )
+Sprite* Sprites::FindPlace( uint pos )
+{
+    // First sprite that drawn after given position
+    if( sortIndexValid )
     {
-        spr = unvalidatedSprites.back();
-        unvalidatedSprites.pop_back();
+        auto it = sortIndex.upper_bound( pos );
+        if( it == sortIndex.begin() )
+            return rootSprite;
+        return ( --it )->second->ChainChild;
+    }
+
+    Sprite* child = rootSprite;
+    while( child && pos >= child->DrawOrderPos )
+        child = child->ChainChild;
+    return child;
+}
+
+void Sprites::LinkSprite( Sprite* spr, Sprite* child )
+{
+    // Insert before child or to the end of chain
+    Sprite* parent = ( child ? child->ChainParent : lastSprite );
+    spr->ChainParent = parent;
+    spr->ChainChild = child;
+    spr->ChainRoot = nullptr;
+    spr->ChainLast = nullptr;
+
+    if( parent )
+    {
+        parent->ChainChild = spr;
     }
     else
     {
-        if( spritesPool.empty() )
-            GrowPool();
-
-        spr = spritesPool.back();
-        spritesPool.pop_back();
+        if( rootSprite )
+            rootSprite->ChainRoot = nullptr;
+        rootSprite = spr;
+        spr->ChainRoot = &rootSprite;
     }
 
-    spr->UnvalidatedPlace = &unvalidatedSprites;
-
-    if( !child )
+    if( child )
     {
-        if( !lastSprite )
-        {
-            rootSprite = spr;
-            lastSprite = spr;
-            spr->ChainRoot = &rootSprite;
-            spr->ChainLast = &lastSprite;
-            spr->ChainParent = nullptr;
-            spr->ChainChild = nullptr;
-            spr->TreeIndex = 0;
-        }
-        else
-        {
-            spr->ChainParent = lastSprite;
-            spr->ChainChild = nullptr;
-            lastSprite->ChainChild = spr;
-            lastSprite->ChainLast = nullptr;
-            spr->ChainLast = &lastSprite;
-            spr->TreeIndex = lastSprite->TreeIndex + 1;
-            lastSprite = spr;
-        }
+        child->ChainParent = spr;
     }
     else
     {
-        spr->ChainChild = child;
-        spr->ChainParent = child->ChainParent;
-        child->ChainParent = spr;
-        if( spr->ChainParent )
-            spr->ChainParent->ChainChild = spr;
+        if( lastSprite )
+            lastSprite->ChainLast = nullptr;
+        lastSprite = spr;
+        spr->ChainLast = &lastSprite;
+    }
 
-        // Recalculate indices
-        uint    index = ( spr->ChainParent ? spr->ChainParent->TreeIndex + 1 : 0 );
-        Sprite* spr_ = spr;
+    // Indices have gaps, recalculate only when no free index between neighbors
+    uint parent_index = ( parent ? parent->TreeIndex : 0 );
+    if( !child && parent_index <= UINT_MAX - SPRITES_TREE_INDEX_STEP )
+    {
+        spr->TreeIndex = parent_index + SPRITES_TREE_INDEX_STEP;
+    }
+    else if( child && child->TreeIndex > parent_index + 1 )
+    {
+        spr->TreeIndex = parent_index + ( child->TreeIndex - parent_index ) / 2;
+    }
+    else
+    {
+        uint    index = 0;
+        Sprite* spr_ = rootSprite;
         while( spr_ )
         {
+            index += SPRITES_TREE_INDEX_STEP;
             spr_->TreeIndex = index;
             spr_ = spr_->ChainChild;
-            index++;
         }
+    }
+}
 
-        if( !spr->ChainParent )
-        {
-            RUNTIME_ASSERT( child->ChainRoot );
-            rootSprite = spr;
-            spr->ChainRoot = &rootSprite;
-            child->ChainRoot = nullptr;
-        }
+void Sprites::UnlinkSprite( Sprite* spr )
+{
+    if( spr->ChainParent )
+    {
+        spr->ChainParent->ChainChild = spr->ChainChild;
+    }
+    else
+    {
+        rootSprite = spr->ChainChild;
+        if( rootSprite )
+            rootSprite->ChainRoot = &rootSprite;
+    }
+
+    if( spr->ChainChild )
+    {
+        spr->ChainChild->ChainParent = spr->ChainParent;
+    }
+    else
+    {
+        lastSprite = spr->ChainParent;
+        if( lastSprite )
+            lastSprite->ChainLast = &lastSprite;
+    }
+
+    spr->ChainRoot = nullptr;
+    spr->ChainLast = nullptr;
+    spr->ChainParent = nullptr;
+    spr->ChainChild = nullptr;
+}
+
+void Sprites::EraseFromSortIndex( Sprite* spr )
+{
+    if( !sortIndexValid )
+        return;
+
+    // Sprite still linked, previous one with same position become last
+    auto it = sortIndex.find( spr->DrawOrderPos );
+    if( it != sortIndex.end() && it->second == spr )
+    {
+        if( spr->ChainParent && spr->ChainParent->DrawOrderPos == spr->DrawOrderPos )
+            it->second = spr->ChainParent;
+        else
+            sortIndex.erase( it );
     }
+}
+
+Sprite& Sprites::PutSprite( Sprite* child, int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback )
+{
+    spriteCount++;
+
+    Sprite* spr;
+    if( !unvalidatedSprites.empty() )
+    {
+        spr = unvalidatedSprites.back();
+        unvalidatedSprites.pop_back();
+    }
+    else
+    {
+        if( spritesPool.empty() )
+            GrowPool();
+
+        spr = spritesPool.back();
+        spritesPool.pop_back();
+    }
+
+    spr->UnvalidatedPlace = &unvalidatedSprites;
+    spr->Tree = this;
+    LinkSprite( spr, child );
 
     spr->HexX = hx;
     spr->HexY = hy;
@@ -293,6 +378,10 @@ Sprite& Sprites::PutSprite( Sprite* child, int draw_order, int hx, int hy, int c
     spr->Parent = nullptr;
     spr->Child = nullptr;
 
+    // Draw order
+    spr->DrawOrderType = draw_order;
+    spr->DrawOrderPos = GetDrawOrderPos( draw_order, hx, hy );
+
     // Cutting
     if( cut == SPRITE_CUT_HORIZONTAL || cut == SPRITE_CUT_VERTICAL )
     {
@@ -322,6 +411,7 @@ Sprite& Sprites::PutSprite( Sprite* child, int draw_order, int hx, int hy, int c
             h2 = spr->HexY + si->Width / 2 / stepi + ( si->Width / 2 % stepi ? 1 : 0 );
             spr->HexY = h1;
         }
+        spr->DrawOrderPos = GetDrawOrderPos( draw_order, spr->HexX, spr->HexY );
 
         float   widthf = (float) si->Width;
         float   xx = 0.0f;
@@ -360,47 +450,56 @@ Sprite& Sprites::PutSprite( Sprite* child, int draw_order, int hx, int hy, int c
         }
     }
 
-    // Draw order
-    spr->DrawOrderType = draw_order;
-    spr->DrawOrderPos = ( draw_order >= DRAW_ORDER_FLAT && draw_order < DRAW_ORDER ?
-                          spr->HexY * MAXHEX_MAX + spr->HexX + MAXHEX_MAX * MAXHEX_MAX * ( draw_order - DRAW_ORDER_FLAT ) :
-                          MAXHEX_MAX * MAXHEX_MAX * DRAW_ORDER + spr->HexY * DRAW_ORDER * MAXHEX_MAX + spr->HexX * DRAW_ORDER + ( draw_order - DRAW_ORDER ) );
-
     return *spr;
 }
 
 Sprite& Sprites::AddSprite( int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback )
 {
-    return PutSprite( nullptr, draw_order, hx, hy, cut, x, y, sx, sy, id, id_ptr, ox, oy, alpha, effect, callback );
+    Sprite& spr = PutSprite( nullptr, draw_order, hx, hy, cut, x, y, sx, sy, id, id_ptr, ox, oy, alpha, effect, callback );
+
+    // Keep index while sprites come in draw order, otherwise it rebuilt by next sort
+    for( Sprite* spr_ = &spr; spr_ && sortIndexValid; spr_ = spr_->Child )
+    {
+        if( spr_->ChainParent && spr_->ChainParent->DrawOrderPos > spr_->DrawOrderPos )
+        {
+            sortIndex.clear();
+            sortIndexValid = false;
+        }
+        else
+        {
+            sortIndex[ spr_->DrawOrderPos ] = spr_;
+        }
+    }
+    return spr;
 }
 
 Sprite& Sprites::InsertSprite( int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback )
 {
-    // For cutted sprites need resort all tree
+    // Cutted sprites placed piece by piece, resort all tree only if order is unknown
     if( cut == SPRITE_CUT_HORIZONTAL || cut == SPRITE_CUT_VERTICAL )
     {
         Sprite& spr = PutSprite( nullptr, draw_order, hx, hy, cut, x, y, sx, sy, id, id_ptr, ox, oy, alpha, effect, callback );
-        SortByMapPos();
+        if( !sortIndexValid )
+        {
+            SortByMapPos();
+            return spr;
+        }
+
+        for( Sprite* spr_ = &spr; spr_; spr_ = spr_->Child )
+        {
+            UnlinkSprite( spr_ );
+            LinkSprite( spr_, FindPlace( spr_->DrawOrderPos ) );
+            sortIndex[ spr_->DrawOrderPos ] = spr_;
+        }
         return spr;
     }
 
     // Find place
-    uint index = 0;
-    uint pos = ( draw_order >= DRAW_ORDER_FLAT && draw_order < DRAW_ORDER ?
-                 hy * MAXHEX_MAX + hx + MAXHEX_MAX * MAXHEX_MAX * ( draw_order - DRAW_ORDER_FLAT ) :
-                 MAXHEX_MAX * MAXHEX_MAX * DRAW_ORDER + hy * DRAW_ORDER * MAXHEX_MAX + hx * DRAW_ORDER + ( draw_order - DRAW_ORDER ) );
-
-    Sprite* parent = rootSprite;
-    while( parent )
-    {
-        if( !parent->Valid )
-            continue;
-        if( pos < parent->DrawOrderPos )
-            break;
-        parent = parent->ChainChild;
-    }
-
-    return PutSprite( parent, draw_order, hx, hy, cut, x, y, sx, sy, id, id_ptr, ox, oy, alpha, effect, callback );
+    uint    pos = GetDrawOrderPos( draw_order, hx, hy );
+    Sprite& spr = PutSprite( FindPlace( pos ), draw_order, hx, hy, cut, x, y, sx, sy, id, id_ptr, ox, oy, alpha, effect, callback );
+    if( sortIndexValid )
+        sortIndex[ pos ] = &spr;
+    return spr;
 }
 
 void Sprites::Unvalidate()
@@ -408,6 +507,8 @@ void Sprites::Unvalidate()
     while( rootSprite )
         rootSprite->Unvalidate();
     spriteCount = 0;
+    sortIndex.clear();
+    sortIndexValid = true;
 }
 
 SprInfoVec* SortSpritesSurfSprData = nullptr;
@@ -464,6 +565,15 @@ void Sprites::SortByMapPos()
     lastSprite = sprites.back();
     rootSprite->ChainRoot = &rootSprite;
     lastSprite->ChainLast = &lastSprite;
+
+    // Now tree in draw order, so index and later insertions can rely on it
+    sortIndex.clear();
+    for( size_t i = 0; i < sprites.size(); i++ )
+    {
+        sprites[ i ]->TreeIndex = (uint) ( i + 1 ) * SPRITES_TREE_INDEX_STEP;
+        sortIndex[ sprites[ i ]->DrawOrderPos ] = sprites[ i ];
+    }
+    sortIndexValid = true;
 }
 
 uint Sprites::Size()
@@ -4,8 +4,10 @@
 #include "GraphicStructures.h"
 
 #define SPRITES_POOL_GROW_SIZE    ( 10000 )
+#define SPRITES_TREE_INDEX_STEP   ( 64 )
 
 class Sprite;
+class Sprites;
 typedef vector< Sprite* > SpriteVec;
 
 class Sprite
@@ -44,6 +46,7 @@ public:
     Sprite*    ChainParent;
     Sprite*    ChainChild;
     SpriteVec* UnvalidatedPlace;
+    Sprites*   Tree;
 
     #ifdef FONLINE_MAPPER
     int CutOyL, CutOyR;
@@ -66,12 +69,17 @@ public:
 class Sprites
 {
 private:
-    static SpriteVec spritesPool;
-    Sprite*          rootSprite;
-    Sprite*          lastSprite;
-    uint             spriteCount;
-    SpriteVec        unvalidatedSprites;
-    Sprite&          PutSprite( Sprite* child, int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback );
+    static SpriteVec     spritesPool;
+    Sprite*              rootSprite;
+    Sprite*              lastSprite;
+    uint                 spriteCount;
+    SpriteVec            unvalidatedSprites;
+    map< uint, Sprite* > sortIndex; // Last sprite in chain for each draw order position
+    bool                 sortIndexValid;
+    Sprite&              PutSprite( Sprite* child, int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback );
+    Sprite*              FindPlace( uint pos );
+    void                 LinkSprite( Sprite* spr, Sprite* child );
+    void                 UnlinkSprite( Sprite* spr );
 
 public:
     static void GrowPool();
@@ -82,6 +90,7 @@ public:
     Sprite& InsertSprite( int draw_order, int hx, int hy, int cut, int x, int y, int* sx, int* sy, uint id, uint* id_ptr, short* ox, short* oy, uchar* alpha, Effect** effect, bool* callback );
     void    Unvalidate();
     void    SortByMapPos();
+    void    EraseFromSortIndex( Sprite* spr );
     uint    Size();
     void    Clear();
 };
@@ -487,6 +487,7 @@ std::wstring _str::toWideChar()
 static Mutex               HashNamesLocker;
 #endif
 static map< hash, string > HashNames;
+static StrSet*             HashNamesRecorder;
 
 hash _str::toHash()
 {
@@ -508,6 +509,9 @@ hash _str::toHash()
     SCOPE_LOCK( HashNamesLocker );
     #endif
 
+    if( HashNamesRecorder )
+        HashNamesRecorder->insert( s );
+
     auto ins = HashNames.insert( std::make_pair( h, "" ) );
     if( ins.second )
     {
@@ -529,6 +533,15 @@ hash _str::toHash()
     return h;
 }
 
+void _str::recordHashes( StrSet* names )
+{
+    #ifndef NO_THREADING
+    SCOPE_LOCK( HashNamesLocker );
+    #endif
+
+    HashNamesRecorder = names;
+}
+
 _str& _str::parseHash( hash h )
 {
     #ifndef NO_THREADING
@@ -102,6 +102,8 @@ public:
     hash  toHash();
     _str& parseHash( hash h );
 
+    static void recordHashes( StrSet* names ); // Collect all names passed to toHash, nullptr to stop
+
     #ifdef FONLINE_SERVER
     static void loadHashes();
     #endif
@@ -216,6 +216,7 @@ THREAD_RET_TYPE dispatcher(void* args){
 			msg->data = data;
 		}else{
 				free(msg);
+				usleep(1000);
 				continue;
 		}
 